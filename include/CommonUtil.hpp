@@ -2,116 +2,1750 @@
 #include <string>
 #include <functional>
 #include <queue>
+#include <algorithm>
 #include <mutex>
 #include <condition_variable>
 #include <thread>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <stdexcept>
+#include <variant>
 #include <memory>
+#include <bit>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <optional>
+#include <string_view>
+#include <vector>
+#include <atomic>
+#include <shared_mutex>
+#include <deque>
+#include <array>
+#include <utility>
+#include <unordered_map>
 #include <DynamicOutput/Output.hpp>
+#include "StructUtil.hpp"
+#include "ObjectLifetimeTracker.hpp"
+
+// Vectorized ASCII runs in StringConv and bulk color packing; define VOTV_NO_SIMD to use the
+// scalar loops only
+#if !defined(VOTV_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define VOTV_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+#if !defined(VOTV_NO_SIMD) && defined(__AVX2__)
+#define VOTV_SIMD_AVX2 1
+#include <immintrin.h>
+#endif
 
 namespace votv::util {
 
-struct FColor {
-    uint8_t r, g, b;
-    
-    static FColor FromHex(const std::string& hex_color) {
-        std::string hex = hex_color;
-        if (hex[0] == '#') hex = hex.substr(1);
-        if (hex.length() != 6) throw std::invalid_argument("Invalid hex color format");
-        
-        return {
-            static_cast<uint8_t>(std::stoul(hex.substr(0, 2), nullptr, 16)),
-            static_cast<uint8_t>(std::stoul(hex.substr(2, 2), nullptr, 16)),
-            static_cast<uint8_t>(std::stoul(hex.substr(4, 2), nullptr, 16))
-        };
+/// 8-bit RGBA color
+///
+/// Example usage:
+/// @code
+/// constexpr FColor Warning = *FColor::TryFromHex("#FFB300");    // checked at compile time
+///
+/// if (auto color = FColor::TryFromHex(config.Get("tint"))) {
+///     tint = color->ToPackedBGRA();
+/// }
+///
+/// FColor::ToPackedBGRA(palette, packed);     // whole table at once
+/// @endcode
+struct FColor {
+    uint8_t r, g, b;
+    uint8_t a = 255;
+
+    /// Parse #RGB, #RGBA, #RRGGBB or #RRGGBBAA, the # being optional
+    /// @return std::nullopt on any other length or a non-hex digit
+    static constexpr std::optional<FColor> TryFromHex(std::string_view hex) {
+        if (!hex.empty() && hex.front() == '#') hex.remove_prefix(1);
+        if (hex.size() != 3 && hex.size() != 4 && hex.size() != 6 && hex.size() != 8) return std::nullopt;
+
+        uint8_t channels[4] = {0, 0, 0, 255};
+        const bool shorthand = hex.size() <= 4;
+        const size_t count = shorthand ? hex.size() : hex.size() / 2;
+        for (size_t i = 0; i < count; ++i) {
+            const int high = HexDigit(hex[shorthand ? i : i * 2]);
+            const int low = shorthand ? high : HexDigit(hex[i * 2 + 1]);
+            if (high < 0 || low < 0) return std::nullopt;
+            channels[i] = static_cast<uint8_t>(high * 16 + low);
+        }
+        return FColor{channels[0], channels[1], channels[2], channels[3]};
+    }
+
+    /// Like TryFromHex, but throws std::invalid_argument on malformed input
+    static constexpr FColor FromHex(std::string_view hex_color) {
+        if (auto color = TryFromHex(hex_color)) return *color;
+        throw std::invalid_argument("Invalid hex color format");
+    }
+    
+    constexpr uint32_t ToPackedBGRA() const {
+        return ToPackedBGRA(a);
+    }
+
+    constexpr uint32_t ToPackedBGRA(uint8_t alpha) const {
+        return (static_cast<uint32_t>(b) << 24) |
+               (static_cast<uint32_t>(g) << 16) |
+               (static_cast<uint32_t>(r) << 8) |
+               static_cast<uint32_t>(alpha);
+    }
+
+    /// Pack many colors, each with its own alpha
+    /// @return Colors packed, the smaller of the two sizes
+    static size_t ToPackedBGRA(std::span<const FColor> colors, std::span<uint32_t> out) {
+        return PackBGRA(colors, out, 0xFFFFFFFFu, 0);
+    }
+
+    /// Pack many colors with one alpha for all
+    static size_t ToPackedBGRA(std::span<const FColor> colors, std::span<uint32_t> out, uint8_t alpha) {
+        return PackBGRA(colors, out, 0xFFFFFF00u, alpha);
+    }
+
+private:
+    static constexpr int HexDigit(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    static size_t PackBGRA(std::span<const FColor> colors, std::span<uint32_t> out, uint32_t keep, uint32_t alpha) {
+        const size_t count = std::min(colors.size(), out.size());
+        size_t i = 0;
+        // Read as a little-endian word, a color is r | g << 8 | b << 16 | a << 24, so the
+        // packed value is that word rotated left by 8
+#if VOTV_SIMD_AVX2
+        const __m256i keep8 = _mm256_set1_epi32(static_cast<int>(keep));
+        const __m256i alpha8 = _mm256_set1_epi32(static_cast<int>(alpha));
+        for (; i + 8 <= count; i += 8) {
+            const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(colors.data() + i));
+            const __m256i rotated = _mm256_or_si256(_mm256_slli_epi32(words, 8), _mm256_srli_epi32(words, 24));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data() + i),
+                _mm256_or_si256(_mm256_and_si256(rotated, keep8), alpha8));
+        }
+#endif
+#if VOTV_SIMD_SSE2
+        const __m128i keep4 = _mm_set1_epi32(static_cast<int>(keep));
+        const __m128i alpha4 = _mm_set1_epi32(static_cast<int>(alpha));
+        for (; i + 4 <= count; i += 4) {
+            const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors.data() + i));
+            const __m128i rotated = _mm_or_si128(_mm_slli_epi32(words, 8), _mm_srli_epi32(words, 24));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i),
+                _mm_or_si128(_mm_and_si128(rotated, keep4), alpha4));
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = (colors[i].ToPackedBGRA() & keep) | alpha;
+        }
+        return count;
+    }
+};
+
+static_assert(sizeof(FColor) == 4, "FColor is packed four colors at a time as 32-bit words");
+
+/// Conversion between UTF-8 and wide strings (UTF-16 where wchar_t is 16-bit, as on Windows)
+///
+/// Invalid UTF-8 and unpaired surrogates become U+FFFD instead of failing. Runs of ASCII are
+/// converted 16 or 32 characters at a time with SSE2/AVX2 when the build targets them.
+///
+/// Example usage:
+/// @code
+/// std::string utf8 = StringConv::ToNarrow(whiteboard->str.GetCharArray());
+///
+/// // Reuse one buffer across calls, e.g. per log line
+/// thread_local std::wstring buffer;
+/// std::wstring_view wide = StringConv::ToWide(utf8, buffer);
+///
+/// // Fixed-size output, nothing allocated
+/// char name[64];
+/// if (auto length = StringConv::ToNarrow(serverBox->name.GetCharArray(), name)) { ... }
+/// @endcode
+class StringConv {
+public:
+    static constexpr char32_t Replacement = 0xFFFD;
+
+    static std::wstring ToWide(std::string_view utf8) {
+        std::wstring wide;
+        ToWide(utf8, wide);
+        return wide;
+    }
+    
+    static std::string ToNarrow(std::wstring_view wide) {
+        // Assume ASCII first, it fits exactly; otherwise size the result properly
+        std::string narrow(wide.size(), '\0');
+        if (auto length = Encode(wide, narrow.data(), narrow.size())) {
+            narrow.resize(*length);
+            return narrow;
+        }
+
+        narrow.resize(NarrowLength(wide));
+        Encode(wide, narrow.data(), narrow.size());
+        return narrow;
+    }
+
+    /// Convert into a reused buffer, which only allocates when it has to grow
+    /// @return View of the buffer, valid until it's next modified
+    static std::wstring_view ToWide(std::string_view utf8, std::wstring& buffer) {
+        // A UTF-8 byte never turns into more than one wide unit
+        buffer.resize(utf8.size());
+        buffer.resize(*Decode(utf8, buffer.data(), buffer.size()));
+        return buffer;
+    }
+
+    static std::string_view ToNarrow(std::wstring_view wide, std::string& buffer) {
+        buffer.resize(wide.size() * MaxBytesPerUnit);
+        buffer.resize(*Encode(wide, buffer.data(), buffer.size()));
+        return buffer;
+    }
+
+    /// Convert into a caller-provided array, without a terminating null
+    /// @return Units written, or std::nullopt if the output doesn't fit
+    static std::optional<size_t> ToWide(std::string_view utf8, std::span<wchar_t> out) {
+        return Decode(utf8, out.data(), out.size());
+    }
+
+    static std::optional<size_t> ToNarrow(std::wstring_view wide, std::span<char> out) {
+        return Encode(wide, out.data(), out.size());
+    }
+
+    /// Exact length of the converted text, for sizing buffers
+    static size_t WideLength(std::string_view utf8) {
+        return *Decode<wchar_t>(utf8, nullptr, 0);
+    }
+
+    static size_t NarrowLength(std::wstring_view wide) {
+        return *Encode(wide, nullptr, 0);
+    }
+
+    /// Transcode UTF-8 into 16- or 32-bit units; counts only when out is null
+    template<typename WideChar>
+    static std::optional<size_t> Decode(std::string_view in, WideChar* out, size_t capacity) {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(in.data());
+        size_t i = 0;
+        size_t written = 0;
+        while (i < in.size()) {
+            if (out) {
+                const size_t run = WidenAscii(in.data() + i, std::min(in.size() - i, capacity - written), out + written);
+                i += run;
+                written += run;
+                if (i == in.size()) break;
+            }
+
+            char32_t code = 0;
+            i += DecodeOne(bytes + i, in.size() - i, code);
+
+            const size_t units = sizeof(WideChar) == 2 && code > 0xFFFF ? 2 : 1;
+            if (out) {
+                if (capacity - written < units) return std::nullopt;
+                if (units == 2) {
+                    out[written] = static_cast<WideChar>(0xD800 + ((code - 0x10000) >> 10));
+                    out[written + 1] = static_cast<WideChar>(0xDC00 + ((code - 0x10000) & 0x3FF));
+                } else {
+                    out[written] = static_cast<WideChar>(code);
+                }
+            }
+            written += units;
+        }
+        return written;
+    }
+
+    /// Transcode 16- or 32-bit units into UTF-8; counts only when out is null
+    template<typename WideChar>
+    static std::optional<size_t> Encode(std::basic_string_view<WideChar> in, char* out, size_t capacity) {
+        size_t i = 0;
+        size_t written = 0;
+        while (i < in.size()) {
+            if (out) {
+                const size_t run = NarrowAscii(in.data() + i, std::min(in.size() - i, capacity - written), out + written);
+                i += run;
+                written += run;
+                if (i == in.size()) break;
+            }
+
+            char32_t code = static_cast<char32_t>(in[i++]);
+            if constexpr (sizeof(WideChar) == 2) {
+                code &= 0xFFFF;
+                if (code >= 0xD800 && code <= 0xDBFF && i < in.size()
+                    && (in[i] & 0xFFFF) >= 0xDC00 && (in[i] & 0xFFFF) <= 0xDFFF) {
+                    code = 0x10000 + ((code - 0xD800) << 10) + ((in[i++] & 0xFFFF) - 0xDC00);
+                } else if (code >= 0xD800 && code <= 0xDFFF) {
+                    code = Replacement;
+                }
+            } else if (code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF)) {
+                code = Replacement;
+            }
+
+            const size_t length = code < 0x80 ? 1 : code < 0x800 ? 2 : code < 0x10000 ? 3 : 4;
+            if (out) {
+                if (capacity - written < length) return std::nullopt;
+                char* dest = out + written;
+                switch (length) {
+                    case 1:
+                        dest[0] = static_cast<char>(code);
+                        break;
+                    case 2:
+                        dest[0] = static_cast<char>(0xC0 | (code >> 6));
+                        dest[1] = static_cast<char>(0x80 | (code & 0x3F));
+                        break;
+                    case 3:
+                        dest[0] = static_cast<char>(0xE0 | (code >> 12));
+                        dest[1] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                        dest[2] = static_cast<char>(0x80 | (code & 0x3F));
+                        break;
+                    default:
+                        dest[0] = static_cast<char>(0xF0 | (code >> 18));
+                        dest[1] = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                        dest[2] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                        dest[3] = static_cast<char>(0x80 | (code & 0x3F));
+                        break;
+                }
+            }
+            written += length;
+        }
+        return written;
+    }
+
+private:
+    static constexpr size_t MaxBytesPerUnit = sizeof(wchar_t) == 2 ? 3 : 4;
+
+    /// Decode one sequence at a non-empty input
+    /// An invalid sequence decodes to U+FFFD and consumes its longest valid prefix, at least a byte
+    /// @return Bytes consumed
+    static size_t DecodeOne(const unsigned char* in, size_t available, char32_t& code) {
+        const unsigned char lead = in[0];
+        if (lead < 0x80) {
+            code = lead;
+            return 1;
+        }
+
+        size_t length = 0;
+        char32_t value = 0;
+        unsigned char lower = 0x80;
+        unsigned char upper = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+            value = lead & 0x1F;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            value = lead & 0x0F;
+            if (lead == 0xE0) lower = 0xA0;         // Overlong
+            else if (lead == 0xED) upper = 0x9F;    // Surrogates
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            value = lead & 0x07;
+            if (lead == 0xF0) lower = 0x90;         // Overlong
+            else if (lead == 0xF4) upper = 0x8F;    // Past U+10FFFF
+        } else {
+            code = Replacement;
+            return 1;
+        }
+
+        for (size_t k = 1; k < length; ++k) {
+            if (k >= available || in[k] < lower || in[k] > upper) {
+                code = Replacement;
+                return k;
+            }
+            value = (value << 6) | (in[k] & 0x3F);
+            lower = 0x80;
+            upper = 0xBF;
+        }
+        code = value;
+        return length;
+    }
+
+    /// Copy the leading ASCII run of in, up to count characters
+    /// @return Characters copied
+    template<typename WideChar>
+    static size_t WidenAscii(const char* in, size_t count, WideChar* out) {
+        size_t i = 0;
+#if VOTV_SIMD_AVX2
+        if constexpr (sizeof(WideChar) == 2) {
+            for (; i + 32 <= count; i += 32) {
+                const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                if (_mm256_movemask_epi8(bytes) != 0) break;
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                    _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 16),
+                    _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1)));
+            }
+        }
+#endif
+#if VOTV_SIMD_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= count; i += 16) {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            if (_mm_movemask_epi8(bytes) != 0) break;
+
+            const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+            const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+            auto* dest = reinterpret_cast<__m128i*>(out + i);
+            if constexpr (sizeof(WideChar) == 2) {
+                _mm_storeu_si128(dest, low);
+                _mm_storeu_si128(dest + 1, high);
+            } else {
+                _mm_storeu_si128(dest, _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128(dest + 1, _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128(dest + 2, _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(dest + 3, _mm_unpackhi_epi16(high, zero));
+            }
+        }
+#endif
+        for (; i < count && static_cast<unsigned char>(in[i]) < 0x80; ++i) {
+            out[i] = static_cast<WideChar>(in[i]);
+        }
+        return i;
+    }
+
+    /// Copy the leading ASCII run of in, up to count units
+    /// @return Units copied
+    template<typename WideChar>
+    static size_t NarrowAscii(const WideChar* in, size_t count, char* out) {
+        size_t i = 0;
+#if VOTV_SIMD_AVX2
+        if constexpr (sizeof(WideChar) == 2) {
+            const __m256i nonAscii = _mm256_set1_epi16(static_cast<short>(0xFF80));
+            for (; i + 32 <= count; i += 32) {
+                const __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                const __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i + 16));
+                if (!_mm256_testz_si256(_mm256_or_si256(first, second), nonAscii)) break;
+
+                // packus interleaves the 128-bit lanes, put them back in order
+                const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xD8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), packed);
+            }
+        }
+#endif
+#if VOTV_SIMD_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        if constexpr (sizeof(WideChar) == 2) {
+            const __m128i nonAscii = _mm_set1_epi16(static_cast<short>(0xFF80));
+            for (; i + 16 <= count; i += 16) {
+                const auto* src = reinterpret_cast<const __m128i*>(in + i);
+                const __m128i first = _mm_loadu_si128(src);
+                const __m128i second = _mm_loadu_si128(src + 1);
+                const __m128i high = _mm_and_si128(_mm_or_si128(first, second), nonAscii);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF) break;
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(first, second));
+            }
+        } else {
+            const __m128i nonAscii = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+            for (; i + 16 <= count; i += 16) {
+                const auto* src = reinterpret_cast<const __m128i*>(in + i);
+                const __m128i a = _mm_loadu_si128(src);
+                const __m128i b = _mm_loadu_si128(src + 1);
+                const __m128i c = _mm_loadu_si128(src + 2);
+                const __m128i d = _mm_loadu_si128(src + 3);
+                const __m128i high = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), nonAscii);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) != 0xFFFF) break;
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                    _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+            }
+        }
+#endif
+        for (; i < count && static_cast<char32_t>(in[i]) < 0x80; ++i) {
+            out[i] = static_cast<char>(in[i]);
+        }
+        return i;
+    }
+};
+
+/// Interned UTF-8 text of FNames, keyed by comparison index and number
+///
+/// Each distinct name is converted once; the returned views stay valid for the process
+/// lifetime. Lookups are lock-free: an open-addressed table whose slots are only ever
+/// filled, and which is replaced (not resized in place) when it grows.
+class FNameStringCache {
+public:
+    static FNameStringCache& Get() {
+        static FNameStringCache instance;
+        return instance;
+    }
+
+    /// Get the UTF-8 text of a name, converting and interning it on first use
+    std::string_view ToUtf8(const RC::Unreal::FName& name) {
+        const uint64_t key = KeyOf(name);
+        if (const std::string* text = Find(key)) return *text;
+        return Insert(key, name);
+    }
+
+    /// Number of interned names
+    size_t Size() const {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr uint64_t EmptyKey = ~0ull;
+    static constexpr size_t InitialCapacity = 1024;   ///< Power of two
+
+    struct Table {
+        explicit Table(size_t capacity) : mask(capacity - 1), keys(capacity), values(capacity) {
+            for (auto& key : keys) key.store(EmptyKey, std::memory_order_relaxed);
+        }
+
+        size_t mask;
+        std::vector<std::atomic<uint64_t>> keys;
+        std::vector<std::atomic<const std::string*>> values;
+    };
+
+    static uint64_t KeyOf(const RC::Unreal::FName& name) {
+        return (static_cast<uint64_t>(name.GetNumber()) << 32) | name.GetComparisonIndex();
+    }
+
+    static size_t SlotOf(uint64_t key, size_t mask) {
+        // Fibonacci hashing spreads sequential comparison indexes
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    }
+
+    const std::string* Find(uint64_t key) const {
+        const Table* table = table_.load(std::memory_order_acquire);
+        for (size_t slot = SlotOf(key, table->mask);; slot = (slot + 1) & table->mask) {
+            const uint64_t stored = table->keys[slot].load(std::memory_order_acquire);
+            if (stored == key) return table->values[slot].load(std::memory_order_relaxed);
+            if (stored == EmptyKey) return nullptr;
+        }
+    }
+
+    std::string_view Insert(uint64_t key, const RC::Unreal::FName& name) {
+        std::string converted = StringConv::ToNarrow(name.ToString());
+
+        std::lock_guard lock(write_mutex_);
+        if (const std::string* text = Find(key)) return *text;
+
+        Table* table = table_.load(std::memory_order_relaxed);
+        if ((count_.load(std::memory_order_relaxed) + 1) * 2 > table->mask + 1) {
+            table = Grow(*table);
+        }
+
+        const std::string* text = &strings_.emplace_back(std::move(converted));
+        Place(*table, key, text);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        return *text;
+    }
+
+    /// Value first, then the key with release, so a reader that sees the key sees the value
+    static void Place(Table& table, uint64_t key, const std::string* text) {
+        size_t slot = SlotOf(key, table.mask);
+        while (table.keys[slot].load(std::memory_order_relaxed) != EmptyKey) {
+            slot = (slot + 1) & table.mask;
+        }
+        table.values[slot].store(text, std::memory_order_relaxed);
+        table.keys[slot].store(key, std::memory_order_release);
+    }
+
+    /// Copy into a table twice the size and publish it; old tables stay alive for readers still on them
+    Table* Grow(const Table& old) {
+        auto& grown = tables_.emplace_back(std::make_unique<Table>((old.mask + 1) * 2));
+        for (size_t slot = 0; slot <= old.mask; ++slot) {
+            const uint64_t key = old.keys[slot].load(std::memory_order_relaxed);
+            if (key != EmptyKey) Place(*grown, key, old.values[slot].load(std::memory_order_relaxed));
+        }
+        table_.store(grown.get(), std::memory_order_release);
+        return grown.get();
+    }
+
+    std::atomic<Table*> table_;
+    std::vector<std::unique_ptr<Table>> tables_;
+    std::deque<std::string> strings_;               ///< Stable storage, views point into it
+    std::atomic<size_t> count_{0};
+    std::mutex write_mutex_;
+
+    FNameStringCache() {
+        tables_.push_back(std::make_unique<Table>(InitialCapacity));
+        table_.store(tables_.back().get(), std::memory_order_release);
+    }
+
+    // Prevent copies
+    FNameStringCache(const FNameStringCache&) = delete;
+    FNameStringCache& operator=(const FNameStringCache&) = delete;
+};
+
+#ifndef VOTV_TASK_INLINE_SIZE
+/// Bytes of captures a Task stores without allocating, sized so a Task fills one cache line
+#define VOTV_TASK_INLINE_SIZE 56
+#endif
+
+/// Move-only `void()` callable with inline storage for small captures
+///
+/// Callables up to InlineSize bytes that are nothrow-movable are stored in place; larger
+/// ones fall back to one heap allocation. Unlike std::function, move-only captures work.
+template<size_t InlineSize>
+class BasicTask {
+public:
+    BasicTask() noexcept = default;
+
+    template<typename F>
+        requires (!std::is_same_v<std::remove_cvref_t<F>, BasicTask> && std::is_invocable_v<std::decay_t<F>&>)
+    BasicTask(F&& callable) {
+        using Callable = std::decay_t<F>;
+
+        // Empty std::function and null function pointers make an empty task
+        if constexpr (std::is_constructible_v<bool, const Callable&>) {
+            if (!static_cast<bool>(callable)) return;
+        }
+
+        if constexpr (fits_inline<Callable>) {
+            new (storage_) Callable(std::forward<F>(callable));
+            ops_ = &inline_ops<Callable>;
+        } else {
+            *static_cast<Callable**>(static_cast<void*>(storage_)) = new Callable(std::forward<F>(callable));
+            ops_ = &heap_ops<Callable>;
+        }
+    }
+
+    BasicTask(BasicTask&& other) noexcept {
+        take(other);
+    }
+
+    BasicTask& operator=(BasicTask&& other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    BasicTask(const BasicTask&) = delete;
+    BasicTask& operator=(const BasicTask&) = delete;
+
+    ~BasicTask() {
+        reset();
+    }
+
+    void operator()() {
+        ops_->invoke(storage_);
+    }
+
+    explicit operator bool() const noexcept {
+        return ops_ != nullptr;
+    }
+
+    /// Whether the callable is stored without a heap allocation
+    bool is_inline() const noexcept {
+        return ops_ && ops_->is_inline;
+    }
+
+    void reset() noexcept {
+        if (ops_) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    template<typename Callable>
+    static constexpr bool fits_inline = sizeof(Callable) <= InlineSize &&
+                                        alignof(Callable) <= alignof(std::max_align_t) &&
+                                        std::is_nothrow_move_constructible_v<Callable>;
+
+private:
+    struct Ops {
+        void (*invoke)(void* storage);
+        void (*move)(void* destination, void* source) noexcept;   ///< Move-construct and destroy the source
+        void (*destroy)(void* storage) noexcept;
+        bool is_inline;
+    };
+
+    template<typename Callable>
+    static constexpr Ops inline_ops{
+        [](void* storage) { (*std::launder(static_cast<Callable*>(storage)))(); },
+        [](void* destination, void* source) noexcept {
+            auto from = std::launder(static_cast<Callable*>(source));
+            new (destination) Callable(std::move(*from));
+            from->~Callable();
+        },
+        [](void* storage) noexcept { std::launder(static_cast<Callable*>(storage))->~Callable(); },
+        true
+    };
+
+    template<typename Callable>
+    static constexpr Ops heap_ops{
+        [](void* storage) { (**static_cast<Callable**>(storage))(); },
+        [](void* destination, void* source) noexcept {
+            *static_cast<Callable**>(destination) = *static_cast<Callable**>(source);
+        },
+        [](void* storage) noexcept { delete *static_cast<Callable**>(storage); },
+        false
+    };
+
+    void take(BasicTask& other) noexcept {
+        if (other.ops_) {
+            other.ops_->move(storage_, other.storage_);
+            ops_ = std::exchange(other.ops_, nullptr);
+        }
+    }
+
+    alignas(std::max_align_t) std::byte storage_[InlineSize < sizeof(void*) ? sizeof(void*) : InlineSize];
+    const Ops* ops_{nullptr};
+};
+
+using Task = BasicTask<VOTV_TASK_INLINE_SIZE>;
+
+/// Scheduling lane of a task, served in this order
+enum class TaskPriority : uint8_t {
+    High,       ///< Latency-critical, e.g. work needed before the next frame
+    Normal,
+    Low,        ///< Bulk background work
+};
+
+inline constexpr size_t TaskPriorityCount = 3;
+
+/// Thrown from a TaskFuture whose task was cancelled or discarded before it ran
+class TaskCancelled : public std::runtime_error {
+public:
+    TaskCancelled() : std::runtime_error("Task cancelled before it ran") {}
+};
+
+/// Read side of a cancellation flag, checked before a queued task starts
+/// A default-constructed token is never cancelled
+class CancellationToken {
+public:
+    CancellationToken() = default;
+
+    bool is_cancelled() const {
+        return flag_ && flag_->load(std::memory_order_acquire);
+    }
+
+    explicit operator bool() const { return flag_ != nullptr; }
+
+private:
+    friend class CancellationSource;
+    explicit CancellationToken(std::shared_ptr<const std::atomic<bool>> flag) : flag_(std::move(flag)) {}
+
+    std::shared_ptr<const std::atomic<bool>> flag_;
+};
+
+/// Owner of a cancellation flag; cancelling skips every queued task holding one of its tokens
+/// Tasks already running aren't interrupted, they can poll their token
+class CancellationSource {
+public:
+    CancellationSource() : flag_(std::make_shared<std::atomic<bool>>(false)) {}
+
+    CancellationToken token() const { return CancellationToken(flag_); }
+
+    void cancel() { flag_->store(true, std::memory_order_release); }
+    bool is_cancelled() const { return flag_->load(std::memory_order_acquire); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> flag_;
+};
+
+/// How AsyncWorker schedules a task
+struct TaskOptions {
+    TaskPriority priority{TaskPriority::Normal};
+    CancellationToken token;
+};
+
+/// Task waiting in an AsyncWorker lane
+struct QueuedTask {
+    Task task;
+    std::chrono::steady_clock::time_point queued_at;
+    CancellationToken token;
+};
+
+/// Growable ring buffer of queued tasks, usable as a deque from both ends
+/// Slots are allocated up front and reused, so steady-state pushes and pops don't allocate
+class TaskRing {
+public:
+    explicit TaskRing(size_t capacity = 256) : slots_(std::bit_ceil(std::max<size_t>(capacity, 2))) {}
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    void push_back(QueuedTask&& task) {
+        if (size_ == slots_.size()) grow();
+        slots_[(head_ + size_) & (slots_.size() - 1)] = std::move(task);
+        ++size_;
+    }
+
+    QueuedTask pop_back() {
+        --size_;
+        return std::move(slots_[(head_ + size_) & (slots_.size() - 1)]);
+    }
+
+    QueuedTask pop_front() {
+        QueuedTask task = std::move(slots_[head_]);
+        head_ = (head_ + 1) & (slots_.size() - 1);
+        --size_;
+        return task;
+    }
+
+    void clear() {
+        while (!empty()) pop_front();
+    }
+
+private:
+    void grow() {
+        std::vector<QueuedTask> grown(slots_.size() * 2);
+        for (size_t i = 0; i < size_; ++i) {
+            grown[i] = std::move(slots_[(head_ + i) & (slots_.size() - 1)]);
+        }
+        slots_ = std::move(grown);
+        head_ = 0;
+    }
+
+    std::vector<QueuedTask> slots_;
+    size_t head_{0};
+    size_t size_{0};
+};
+
+/// Shared result slot of a TaskFuture
+/// Completion wakes blocking waiters and resumes an awaiting coroutine, on the completing thread
+template<typename T>
+class FutureState {
+public:
+    using Value = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+    template<typename... Args>
+    void set_value(Args&&... args) {
+        value_.emplace(std::forward<Args>(args)...);
+        complete();
+    }
+
+    void set_exception(std::exception_ptr error) {
+        error_ = std::move(error);
+        complete();
+    }
+
+    bool is_ready() const {
+        return ready_.load(std::memory_order_acquire) != 0;
+    }
+
+    void wait() const {
+        ready_.wait(0, std::memory_order_acquire);
+    }
+
+    /// Register a coroutine to resume on completion
+    /// @return false if the result is already set, resume the coroutine yourself
+    bool set_continuation(std::coroutine_handle<> handle) {
+        void* expected = nullptr;
+        return continuation_.compare_exchange_strong(expected, handle.address(), std::memory_order_acq_rel);
+    }
+
+    Value take() {
+        if (error_) std::rethrow_exception(error_);
+        return std::move(*value_);
+    }
+
+private:
+    void complete() {
+        ready_.store(1, std::memory_order_release);
+        ready_.notify_all();
+
+        void* continuation = continuation_.exchange(completed_marker(), std::memory_order_acq_rel);
+        if (continuation) {
+            std::coroutine_handle<>::from_address(continuation).resume();
+        }
+    }
+
+    static void* completed_marker() {
+        static char marker;
+        return &marker;
+    }
+
+    std::optional<Value> value_;
+    std::exception_ptr error_;
+    std::atomic<uint32_t> ready_{0};
+    std::atomic<void*> continuation_{nullptr};
+};
+
+template<typename T>
+class TaskFuture;
+
+namespace detail {
+
+template<typename T>
+struct FuturePromiseBase {
+    std::shared_ptr<FutureState<T>> state = std::make_shared<FutureState<T>>();
+
+    TaskFuture<T> get_return_object() { return TaskFuture<T>(state); }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void unhandled_exception() { state->set_exception(std::current_exception()); }
+
+    // A frame destroyed while suspended, e.g. its queued resumption was discarded
+    ~FuturePromiseBase() {
+        if (!state->is_ready()) state->set_exception(std::make_exception_ptr(TaskCancelled{}));
+    }
+};
+
+template<typename T>
+struct FuturePromise : FuturePromiseBase<T> {
+    template<typename U>
+    void return_value(U&& value) { this->state->set_value(std::forward<U>(value)); }
+};
+
+template<>
+struct FuturePromise<void> : FuturePromiseBase<void> {
+    void return_void() { this->state->set_value(); }
+};
+
+}
+
+/// Result of work running elsewhere: a task from AsyncWorker::submit() or a coroutine
+///
+/// Block on it with get(), or co_await it from a coroutine. A function returning
+/// TaskFuture<T> may itself be a coroutine; it starts running immediately and its frame is
+/// freed when it finishes.
+///
+/// Example usage:
+/// @code
+/// TaskFuture<void> rescan(AsyncWorker& worker) {
+///     co_await worker.schedule();          // now on a worker
+///     auto result = scan_save();
+///     co_await game_thread();              // next GameThreadQueue drain
+///     apply(result);
+/// }
+/// @endcode
+/// @note get() from the game thread deadlocks if the work itself waits for game_thread()
+template<typename T = void>
+class TaskFuture {
+public:
+    using promise_type = detail::FuturePromise<T>;
+
+    TaskFuture() = default;
+    explicit TaskFuture(std::shared_ptr<FutureState<T>> state) : state_(std::move(state)) {}
+
+    bool valid() const { return state_ != nullptr; }
+    bool is_ready() const { return state_ && state_->is_ready(); }
+
+    void wait() const {
+        if (state_) state_->wait();
+    }
+
+    /// Wait for and take the result, rethrowing the task's exception
+    /// @note Call once, the value is moved out
+    T get() {
+        wait();
+        if constexpr (std::is_void_v<T>) {
+            state_->take();
+        } else {
+            return state_->take();
+        }
+    }
+
+    bool await_ready() const { return is_ready(); }
+    bool await_suspend(std::coroutine_handle<> handle) { return state_->set_continuation(handle); }
+    T await_resume() { return get(); }
+
+private:
+    std::shared_ptr<FutureState<T>> state_;
+};
+
+/// What AsyncWorker::shutdown() does with tasks that haven't started
+enum class ShutdownPolicy : uint8_t {
+    Drain,      ///< Run them, including tasks they queue, until idle or the timeout
+    Discard,    ///< Destroy them without running; running tasks finish normally
+    Cancel,     ///< Discard, and cancel shutdown_token() so running tasks can bail out early
+};
+
+/// Thread pool with per-worker deques, work stealing and priority lanes
+///
+/// Tasks queued from outside the pool are spread round-robin over the workers; tasks queued
+/// from a worker go to its own deque. A worker runs its own tasks oldest first and steals the
+/// newest task of another worker when its deque is empty. Exceptions thrown by tasks are
+/// logged and don't stop the worker.
+///
+/// Each deque has one lane per TaskPriority and higher lanes are served first. To keep bulk
+/// work from starving, every StarvationInterval-th pick on a worker starts from a lower lane.
+/// Queued tasks whose CancellationToken is cancelled are dropped when they come up.
+///
+/// With the default single thread, tasks of one priority run in submission order.
+///
+/// A discarded task is destroyed without running: its submit() future throws TaskCancelled,
+/// a TaskGroup counts it as done and a coroutine waiting in schedule() is destroyed.
+///
+/// Example usage:
+/// @code
+/// // Level unload: flush what's queued within the window, then stop
+/// if (!worker.shutdown(ShutdownPolicy::Drain, std::chrono::milliseconds(50))) {
+///     Output::send<LogLevel::Warning>(STR("Dropped unfinished background work\n"));
+/// }
+/// @endcode
+class AsyncWorker {
+public:
+    /// Picks per worker after which a lower lane is served first once
+    static constexpr uint32_t StarvationInterval = 8;
+
+    /// Snapshot of one lane's counters
+    struct LaneStats {
+        size_t depth{0};                        ///< Tasks currently queued
+        uint64_t started{0};                    ///< Tasks taken from the lane to run
+        uint64_t cancelled{0};                  ///< Tasks dropped because their token was cancelled
+        std::chrono::nanoseconds average_wait{0};   ///< Mean time from queueing to start
+        std::chrono::nanoseconds max_wait{0};
+        uint64_t discarded{0};                  ///< Tasks dropped by shutdown()
+    };
+
+    explicit AsyncWorker(size_t thread_count = 1) {
+        thread_count = std::max<size_t>(thread_count, 1);
+        workers_.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i) {
+            workers_.push_back(std::make_unique<Worker>());
+        }
+        for (size_t i = 0; i < thread_count; ++i) {
+            workers_[i]->thread = std::jthread([this, i](std::stop_token token) {
+                worker_loop(i, token);
+            });
+        }
+    }
+    
+    /// Discards queued tasks and joins the workers; call shutdown(ShutdownPolicy::Drain) first
+    /// to flush them
+    ~AsyncWorker() {
+        shutdown(ShutdownPolicy::Discard);
+    }
+
+    /// Pool sized to the machine, shared by everything in this module instead of private threads
+    /// The header is compiled into each mod, so every mod DLL gets its own pool. It's never
+    /// destroyed by a static destructor, which would join threads under the loader lock;
+    /// call shutdown_shared() from the mod's uninstall path instead.
+    static AsyncWorker& shared() {
+        static AsyncWorker* instance = [] {
+            auto* pool = new AsyncWorker(default_thread_count());
+            shared_instance_.store(pool, std::memory_order_release);
+            return pool;
+        }();
+        return *instance;
+    }
+
+    /// Stop the shared pool if it was ever created, e.g. from a mod's uninstall handler
+    /// Must run before the module unloads and not from DllMain. The pool stays allocated and
+    /// rejects new tasks afterwards.
+    /// @return See shutdown(); true if the pool was never created
+    static bool shutdown_shared(ShutdownPolicy policy = ShutdownPolicy::Drain,
+                                std::chrono::milliseconds timeout = std::chrono::milliseconds::max()) {
+        AsyncWorker* pool = shared_instance_.load(std::memory_order_acquire);
+        return pool ? pool->shutdown(policy, timeout) : true;
+    }
+
+    /// One worker per hardware thread, leaving one for the game thread
+    static size_t default_thread_count() {
+        const size_t hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 1;
+    }
+    
+    void queue_task(Task task, TaskOptions options = {}) {
+        push_task(std::move(task), std::move(options));
+    }
+
+    /// Queue a callable and get a future for its result
+    /// Exceptions go to the future instead of the log; a cancelled task throws TaskCancelled
+    template<typename F>
+    auto submit(F&& callable, TaskOptions options = {}) -> TaskFuture<std::invoke_result_t<std::decay_t<F>&>> {
+        using R = std::invoke_result_t<std::decay_t<F>&>;
+        auto state = std::make_shared<FutureState<R>>();
+
+        // Settles the future with TaskCancelled if the task is destroyed without running
+        struct Promise {
+            std::shared_ptr<FutureState<R>> state;
+
+            Promise(std::shared_ptr<FutureState<R>> futureState) : state(std::move(futureState)) {}
+            Promise(Promise&&) noexcept = default;
+            ~Promise() {
+                if (state) state->set_exception(std::make_exception_ptr(TaskCancelled{}));
+            }
+        };
+
+        push_task([promise = Promise(state), callable = std::decay_t<F>(std::forward<F>(callable))]() mutable {
+            auto state = std::move(promise.state);
+            try {
+                if constexpr (std::is_void_v<R>) {
+                    callable();
+                    state->set_value();
+                } else {
+                    state->set_value(callable());
+                }
+            } catch (...) {
+                state->set_exception(std::current_exception());
+            }
+        }, std::move(options));
+        return TaskFuture<R>(std::move(state));
+    }
+
+    /// Awaitable that moves a coroutine onto one of the pool's workers
+    /// Resumes inline if the pool is shutting down; if shutdown discards the queued
+    /// resumption, the coroutine is destroyed and its TaskFuture throws TaskCancelled
+    auto schedule(TaskPriority priority = TaskPriority::Normal) {
+        // Owns the suspended coroutine until it's resumed
+        struct Resume {
+            std::coroutine_handle<> handle;
+
+            explicit Resume(std::coroutine_handle<> suspended) : handle(suspended) {}
+            Resume(Resume&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+            ~Resume() {
+                if (handle) handle.destroy();
+            }
+
+            void operator()() { std::exchange(handle, nullptr).resume(); }
+        };
+
+        struct Awaiter {
+            AsyncWorker& worker;
+            TaskPriority priority;
+
+            bool await_ready() const noexcept { return false; }
+            bool await_suspend(std::coroutine_handle<> handle) {
+                Resume resume(handle);
+                if (worker.push_task(std::move(resume), {priority, {}})) return true;
+
+                resume.handle = nullptr;
+                return false;
+            }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{*this, priority};
+    }
+
+    /// Queue many tasks with one lock, moving them out of the span
+    /// They land on one worker's deque and the others steal from it
+    void queue_tasks(std::span<Task> tasks, TaskOptions options = {}) {
+        const size_t index = current_pool_ == this
+            ? current_index_
+            : next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+        const size_t lane = static_cast<size_t>(options.priority);
+        const auto now = std::chrono::steady_clock::now();
+
+        size_t count = 0;
+        {
+            std::lock_guard lock(workers_[index]->mutex);
+            if (!accepts_tasks()) return;
+
+            for (Task& task : tasks) {
+                if (!task) continue;
+                workers_[index]->lanes[lane].push_back({std::move(task), now, options.token});
+                ++count;
+            }
+            outstanding_.fetch_add(count, std::memory_order_relaxed);
+            lanes_[lane].depth.fetch_add(count, std::memory_order_relaxed);
+            queued_.fetch_add(count, std::memory_order_release);
+        }
+
+        if (count == 1) {
+            wake_one();
+        } else if (count > 1) {
+            {
+                std::lock_guard lock(sleep_mutex_);
+            }
+            sleep_cv_.notify_all();
+        }
+    }
+
+    /// Block until every queued task has finished
+    /// @note Not callable from a worker thread, the calling task itself would never finish;
+    ///       use a TaskGroup there instead
+    void wait_idle() {
+        drain(std::chrono::milliseconds::max());
+    }
+
+    /// Block until every queued task has finished or the timeout passes
+    /// The pool keeps accepting tasks, so producers that don't stop can keep it busy
+    /// @return true if the pool went idle
+    bool drain(std::chrono::milliseconds timeout) {
+        if (current_pool_ == this) {
+            RC::Output::send<RC::LogLevel::Error>(STR("[AsyncWorker] drain called from a worker thread\n"));
+            return false;
+        }
+
+        const auto idle = [this] { return outstanding_.load(std::memory_order_acquire) == 0; };
+        std::unique_lock lock(idle_mutex_);
+        if (timeout == std::chrono::milliseconds::max()) {
+            idle_cv_.wait(lock, idle);
+            return true;
+        }
+        return idle_cv_.wait_for(lock, timeout, idle);
+    }
+
+    /// Completion barrier: a future that's ready once no task is queued or running
+    /// Awaitable from a coroutine; it resumes on the worker that finished the last task
+    TaskFuture<void> when_idle() {
+        auto state = std::make_shared<FutureState<void>>();
+        {
+            std::lock_guard lock(idle_mutex_);
+            if (outstanding_.load(std::memory_order_acquire) != 0) {
+                idle_waiters_.push_back(state);
+                return TaskFuture<void>(std::move(state));
+            }
+        }
+        state->set_value();
+        return TaskFuture<void>(std::move(state));
+    }
+
+    /// Run one queued task on the calling thread, if any
+    /// Lets a thread that waits on its own tasks help instead of blocking
+    /// @return true if a task was run
+    bool try_run_one() {
+        Picked task;
+        const size_t start = current_pool_ == this ? current_index_ : 0;
+        if (!try_pop(start, task)) return false;
+
+        execute(task);
+        return true;
+    }
+
+    /// Counters of one priority lane
+    LaneStats lane_stats(TaskPriority priority) const {
+        const Lane& lane = lanes_[static_cast<size_t>(priority)];
+        LaneStats stats;
+        stats.depth = lane.depth.load(std::memory_order_relaxed);
+        stats.started = lane.started.load(std::memory_order_relaxed);
+        stats.cancelled = lane.cancelled.load(std::memory_order_relaxed);
+        stats.max_wait = std::chrono::nanoseconds(lane.max_wait_ns.load(std::memory_order_relaxed));
+        stats.discarded = lane.discarded.load(std::memory_order_relaxed);
+        if (stats.started > 0) {
+            stats.average_wait = std::chrono::nanoseconds(
+                lane.total_wait_ns.load(std::memory_order_relaxed) / stats.started);
+        }
+        return stats;
+    }
+    
+    /// Stop accepting tasks, settle the queued ones by policy and join the workers
+    ///
+    /// With Drain, tasks queued by running tasks are still accepted until the pool is idle
+    /// or the timeout passes; whatever is left then is discarded. Tasks queued after
+    /// shutdown starts from other threads are rejected, and schedule() resumes inline.
+    /// Blocks until running tasks return. Later calls only wait for the first to finish.
+    /// @return true if no queued task was discarded
+    /// @note Not callable from a worker thread, it can't join itself
+    bool shutdown(ShutdownPolicy policy = ShutdownPolicy::Drain,
+                  std::chrono::milliseconds timeout = std::chrono::milliseconds::max()) {
+        if (current_pool_ == this) {
+            RC::Output::send<RC::LogLevel::Error>(STR("[AsyncWorker] shutdown called from a worker thread\n"));
+            return false;
+        }
+
+        std::lock_guard shutdown_lock(shutdown_mutex_);
+        if (state_.load(std::memory_order_acquire) == State::Stopped) return true;
+
+        state_.store(State::Draining, std::memory_order_release);
+        if (policy == ShutdownPolicy::Cancel) shutdown_source_.cancel();
+
+        const bool drained = policy == ShutdownPolicy::Drain && drain(timeout);
+
+        // Lock every deque once so no push slips past the state change, then discard
+        for (auto& worker : workers_) {
+            std::lock_guard lock(worker->mutex);
+        }
+        {
+            std::lock_guard lock(sleep_mutex_);
+            state_.store(State::Stopped, std::memory_order_release);
+        }
+        const size_t discarded = discard_queued();
+        sleep_cv_.notify_all();
+
+        for (auto& worker : workers_) {
+            if (worker->thread.joinable()) worker->thread.join();
+        }
+
+        if (discarded > 0) {
+            RC::Output::send<RC::LogLevel::Verbose>(
+                STR("[AsyncWorker] Discarded {} queued tasks on shutdown\n"), discarded);
+        }
+        return drained || discarded == 0;
+    }
+
+    /// Whether shutdown() has started; tasks from outside the pool are rejected from then on
+    bool is_shutting_down() const {
+        return state_.load(std::memory_order_acquire) != State::Running;
+    }
+
+    /// Cancelled by shutdown(ShutdownPolicy::Cancel); long tasks can poll it to stop early
+    CancellationToken shutdown_token() const {
+        return shutdown_source_.token();
+    }
+
+    size_t thread_count() const {
+        return workers_.size();
     }
-    
-    uint32_t ToPackedBGRA(uint8_t alpha = 255) const {
-        return (static_cast<uint32_t>(b) << 24) |
-               (static_cast<uint32_t>(g) << 16) |
-               (static_cast<uint32_t>(r) << 8) |
-               static_cast<uint32_t>(alpha);
+
+    /// Whether the calling thread is one of this pool's workers
+    bool is_worker_thread() const {
+        return current_pool_ == this;
     }
-};
 
-class StringConv {
-public:
-    static std::wstring ToWide(const std::string& str) {
-        return std::wstring(str.begin(), str.end());
+private:
+    struct Worker {
+        std::array<TaskRing, TaskPriorityCount> lanes;
+        std::mutex mutex;
+        std::jthread thread;
+        uint32_t picks{0};                      ///< Only touched by the worker's own thread
+    };
+
+    /// Task taken off a lane, with the lane it came from
+    struct Picked {
+        QueuedTask entry;
+        TaskPriority priority_lane{TaskPriority::Normal};
+    };
+
+    struct Lane {
+        std::atomic<size_t> depth{0};
+        std::atomic<uint64_t> started{0};
+        std::atomic<uint64_t> cancelled{0};
+        std::atomic<uint64_t> total_wait_ns{0};
+        std::atomic<uint64_t> max_wait_ns{0};
+        std::atomic<uint64_t> discarded{0};
+    };
+
+    enum class State : uint8_t {
+        Running,
+        Draining,       ///< Only tasks queued from the pool's own workers are accepted
+        Stopped,
+    };
+
+    /// Checked under a worker mutex, which shutdown() takes after changing state
+    bool accepts_tasks() const {
+        const State state = state_.load(std::memory_order_acquire);
+        return state == State::Running || (state == State::Draining && current_pool_ == this);
     }
-    
-    static std::string ToNarrow(const std::wstring& wstr) {
-        return std::string(wstr.begin(), wstr.end());
+
+    /// Takes the callable only if the pool accepts it, a rejected one is left with the caller
+    template<typename F>
+    bool push_task(F&& callable, TaskOptions options) {
+        if constexpr (std::is_same_v<std::decay_t<F>, Task>) {
+            if (!callable) return false;
+        }
+        if (!accepts_tasks()) return false;
+
+        // Stay local when called from one of our workers, it's likely to touch the same data
+        const size_t index = current_pool_ == this
+            ? current_index_
+            : next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+        const size_t lane = static_cast<size_t>(options.priority);
+        {
+            std::lock_guard lock(workers_[index]->mutex);
+            if (!accepts_tasks()) return false;
+
+            outstanding_.fetch_add(1, std::memory_order_relaxed);
+            workers_[index]->lanes[lane].push_back(
+                {Task(std::forward<F>(callable)), std::chrono::steady_clock::now(), std::move(options.token)});
+            lanes_[lane].depth.fetch_add(1, std::memory_order_relaxed);
+            queued_.fetch_add(1, std::memory_order_release);
+        }
+        wake_one();
+        return true;
     }
-};
 
-class AsyncWorker {
-public:
-    AsyncWorker() : shutdown_(false) {
-        worker_thread_ = std::make_unique<std::jthread>([this](std::stop_token token) {
-            worker_loop(token);
-        });
+    void worker_loop(size_t index, std::stop_token stop_token) {
+        current_pool_ = this;
+        current_index_ = index;
+
+        while (!stop_token.stop_requested() && state_.load(std::memory_order_acquire) != State::Stopped) {
+            Picked task;
+            if (try_pop(index, task)) {
+                execute(task);
+                continue;
+            }
+
+            std::unique_lock lock(sleep_mutex_);
+            sleep_cv_.wait(lock, [this, &stop_token] {
+                return queued_.load(std::memory_order_acquire) > 0 || stop_token.stop_requested()
+                    || state_.load(std::memory_order_acquire) == State::Stopped;
+            });
+        }
     }
-    
-    ~AsyncWorker() {
-        shutdown();
+
+    /// Take the next task by lane priority, dropping cancelled ones on the way
+    bool try_pop(size_t index, Picked& task) {
+        while (queued_.load(std::memory_order_acquire) > 0) {
+            if (!try_pop_any(index, task)) return false;
+
+            const size_t lane = static_cast<size_t>(task.priority_lane);
+            if (!task.entry.token.is_cancelled()) {
+                record_start(lane, task.entry.queued_at);
+                return true;
+            }
+
+            lanes_[lane].cancelled.fetch_add(1, std::memory_order_relaxed);
+            task.entry = {};
+            finish_one();
+        }
+        return false;
     }
-    
-    void queue_task(std::function<void()> task) {
+
+    /// Pop from the highest non-empty lane, oldest of our own deque first, else the newest of another
+    bool try_pop_any(size_t index, Picked& task) {
+        // Rotate which lower lane goes first on every StarvationInterval-th pick
+        size_t first_lane = 0;
+        if (current_pool_ == this && index == current_index_) {
+            const uint32_t picks = ++workers_[index]->picks;
+            if (picks % StarvationInterval == 0) {
+                first_lane = 1 + (picks / StarvationInterval) % (TaskPriorityCount - 1);
+            }
+        }
+
+        for (size_t n = 0; n < TaskPriorityCount; ++n) {
+            const size_t lane = (first_lane + n) % TaskPriorityCount;
+            if (lanes_[lane].depth.load(std::memory_order_acquire) == 0) continue;
+
+            for (size_t i = 0; i < workers_.size(); ++i) {
+                Worker& worker = *workers_[(index + i) % workers_.size()];
+                std::lock_guard lock(worker.mutex);
+                TaskRing& ring = worker.lanes[lane];
+                if (ring.empty()) continue;
+
+                task.entry = i == 0 ? ring.pop_front() : ring.pop_back();
+                task.priority_lane = static_cast<TaskPriority>(lane);
+                lanes_[lane].depth.fetch_sub(1, std::memory_order_relaxed);
+                queued_.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void record_start(size_t lane, std::chrono::steady_clock::time_point queued_at) {
+        const auto waited = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - queued_at).count());
+
+        Lane& stats = lanes_[lane];
+        stats.started.fetch_add(1, std::memory_order_relaxed);
+        stats.total_wait_ns.fetch_add(waited, std::memory_order_relaxed);
+        uint64_t max = stats.max_wait_ns.load(std::memory_order_relaxed);
+        while (waited > max && !stats.max_wait_ns.compare_exchange_weak(max, waited, std::memory_order_relaxed)) {}
+    }
+
+    void execute(Picked& task) {
+        try {
+            task.entry.task();
+        } catch (const std::exception& e) {
+            RC::Output::send<RC::LogLevel::Error>(
+                STR("[AsyncWorker] Task error: {}\n"),
+                StringConv::ToWide(e.what())
+            );
+        } catch (...) {
+            RC::Output::send<RC::LogLevel::Error>(STR("[AsyncWorker] Task error: unknown exception\n"));
+        }
+        task.entry = {};
+        finish_one();
+    }
+
+    /// Destroy every queued task without running it
+    /// Destructors run outside the deque locks, they may try to queue more work
+    size_t discard_queued() {
+        std::vector<std::pair<size_t, QueuedTask>> dropped;
+        for (auto& worker : workers_) {
+            std::lock_guard lock(worker->mutex);
+            for (size_t lane = 0; lane < TaskPriorityCount; ++lane) {
+                while (!worker->lanes[lane].empty()) {
+                    dropped.emplace_back(lane, worker->lanes[lane].pop_front());
+                    lanes_[lane].depth.fetch_sub(1, std::memory_order_relaxed);
+                    queued_.fetch_sub(1, std::memory_order_acq_rel);
+                }
+            }
+        }
+
+        for (auto& [lane, task] : dropped) {
+            lanes_[lane].discarded.fetch_add(1, std::memory_order_relaxed);
+            task = {};
+            finish_one();
+        }
+        return dropped.size();
+    }
+
+    void finish_one() {
+        if (outstanding_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::vector<std::shared_ptr<FutureState<void>>> waiters;
+            {
+                std::lock_guard lock(idle_mutex_);
+                // A task queued since the decrement may have a when_idle() waiting on it; the
+                // finish_one that brings the count back to zero completes the waiters instead
+                if (outstanding_.load(std::memory_order_acquire) != 0) return;
+                waiters.swap(idle_waiters_);
+            }
+            idle_cv_.notify_all();
+            for (auto& waiter : waiters) {
+                waiter->set_value();
+            }
+        }
+    }
+
+    void wake_one() {
         {
-            std::lock_guard lock(queue_mutex_);
-            task_queue_.push(std::move(task));
+            // Pairs with the predicate check in worker_loop so the wakeup can't be lost
+            std::lock_guard lock(sleep_mutex_);
         }
-        cv_.notify_one();
+        sleep_cv_.notify_one();
     }
     
-    void shutdown() {
-        shutdown_ = true;
-        cv_.notify_all();
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::array<Lane, TaskPriorityCount> lanes_;
+    std::atomic<size_t> next_worker_{0};
+    std::atomic<size_t> queued_{0};         ///< Tasks sitting in deques
+    std::atomic<size_t> outstanding_{0};    ///< Tasks queued or running
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    std::mutex idle_mutex_;
+    std::condition_variable idle_cv_;
+    std::vector<std::shared_ptr<FutureState<void>>> idle_waiters_;
+    std::mutex shutdown_mutex_;
+    std::atomic<State> state_{State::Running};
+    CancellationSource shutdown_source_;
+
+    static inline thread_local AsyncWorker* current_pool_{nullptr};
+    static inline thread_local size_t current_index_{0};
+    static inline std::atomic<AsyncWorker*> shared_instance_{nullptr};     ///< Set once shared() created the pool
+};
+
+/// Set of tasks on an AsyncWorker that can be waited on together
+///
+/// Example usage:
+/// @code
+/// TaskGroup group(AsyncWorker::shared());
+/// for (auto& chunk : chunks) {
+///     group.run([&chunk] { process(chunk); });
+/// }
+/// group.wait();
+/// @endcode
+class TaskGroup {
+public:
+    explicit TaskGroup(AsyncWorker& worker) : worker_(worker) {}
+
+    ~TaskGroup() {
+        wait();
     }
-    
-    bool is_shutting_down() const {
-        return shutdown_;
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /// Queue a callable as part of the group
+    /// Takes the callable itself rather than a Task so the wrapper still fits inline
+    /// A task that is cancelled before it runs still counts as done
+    template<typename F>
+    void run(F&& callable, TaskOptions options = {}) {
+        using Callable = std::decay_t<F>;
+        if constexpr (std::is_constructible_v<bool, const Callable&>) {
+            if (!static_cast<bool>(callable)) return;
+        }
+
+        // Counts the task done when the wrapper goes away, whether it ran, threw or was dropped
+        struct Done {
+            TaskGroup* group;
+
+            explicit Done(TaskGroup* owner) : group(owner) {}
+            Done(Done&& other) noexcept : group(std::exchange(other.group, nullptr)) {}
+            ~Done() {
+                if (group) group->finish_one();
+            }
+        };
+
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        worker_.queue_task([done = Done(this), callable = Callable(std::forward<F>(callable))]() mutable {
+            Done finished = std::move(done);
+            callable();
+        }, std::move(options));
+    }
+
+    /// Block until every task run through this group has finished
+    /// On a worker thread, runs queued tasks while waiting instead of blocking the worker
+    void wait() {
+        size_t pending = pending_.load(std::memory_order_acquire);
+        while (pending != 0) {
+            if (worker_.is_worker_thread() && worker_.try_run_one()) {
+                pending = pending_.load(std::memory_order_acquire);
+                continue;
+            }
+            pending_.wait(pending, std::memory_order_acquire);
+            pending = pending_.load(std::memory_order_acquire);
+        }
+    }
+
+    size_t pending() const {
+        return pending_.load(std::memory_order_acquire);
     }
 
 private:
-    void worker_loop(std::stop_token stop_token) {
-        while (!stop_token.stop_requested() && !shutdown_) {
-            std::function<void()> task;
-            
-            {
-                std::unique_lock lock(queue_mutex_);
-                cv_.wait(lock, [this, &stop_token] {
-                    return !task_queue_.empty() || stop_token.stop_requested() || shutdown_;
-                });
-                
-                if (stop_token.stop_requested() || shutdown_) break;
-                
-                if (!task_queue_.empty()) {
-                    task = std::move(task_queue_.front());
-                    task_queue_.pop();
-                }
+    void finish_one() {
+        if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            pending_.notify_all();
+        }
+    }
+
+    AsyncWorker& worker_;
+    std::atomic<size_t> pending_{0};
+};
+
+/// Queue of work to run on the game thread, posted from any thread
+///
+/// Producers push onto a lock-free MPSC list; the game thread drains it from a tick or
+/// ProcessEvent hook within a time budget, leaving the rest for the next frame. Work posted
+/// for an actor is dropped if the actor died in the meantime, checked through a TrackedPtr
+/// taken on the game thread.
+///
+/// Example usage:
+/// @code
+/// TrackedPtr<AActor> plant(plantActor);
+/// AsyncWorker::shared().queue_task([plant] {
+///     auto result = analyze();
+///     GameThreadQueue::get().post_for(plant, [plant, result] { plant->water = result; });
+/// });
+///
+/// // In a tick hook
+/// GameThreadQueue::get().drain(std::chrono::milliseconds(2));
+/// @endcode
+class GameThreadQueue {
+public:
+    static GameThreadQueue& get() {
+        static GameThreadQueue instance;
+        return instance;
+    }
+
+    GameThreadQueue() : head_(&stub_), tail_(&stub_) {}
+
+    ~GameThreadQueue() {
+        while (Node* node = pop()) delete node;
+    }
+
+    GameThreadQueue(const GameThreadQueue&) = delete;
+    GameThreadQueue& operator=(const GameThreadQueue&) = delete;
+
+    /// Queue work for the game thread
+    void post(Task task) {
+        if (!task) return;
+        push(new Node{{nullptr}, std::move(task), nullptr, INDEX_NONE, 0});
+    }
+
+    /// Queue work that only runs if an actor is still alive when the queue is drained
+    /// Safe from any thread; a raw pointer can't be validated off the game thread, so take
+    /// the handle there before handing it to a worker
+    /// @param target Handle to the actor the work touches; work for an untracked handle is dropped
+    template<typename T>
+    void post_for(const TrackedPtr<T>& target, Task task) {
+        if (!task) return;
+        if (target.GetSerial() == 0) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        push(new Node{{nullptr}, std::move(task), target.GetUnchecked(), target.GetIndex(), target.GetSerial()});
+    }
+
+    /// Run queued work on the calling (game) thread
+    /// At least one task runs per call so the queue always makes progress
+    /// @param budget Stop starting new tasks once this much time has passed
+    /// @return Number of tasks run, dropped tasks not included
+    size_t drain(std::chrono::microseconds budget = std::chrono::milliseconds(2)) {
+        const auto deadline = std::chrono::steady_clock::now() + budget;
+        auto& tracker = ObjectLifetimeTracker::Get();
+
+        size_t ran = 0;
+        while (Node* node = pop()) {
+            std::unique_ptr<Node> owned(node);
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+
+            if (owned->target && !tracker.IsAlive(owned->index, owned->serial)) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                continue;
             }
-            
-            if (task) {
-                try {
-                    task();
-                } catch (const std::exception& e) {
-                    RC::Output::send<RC::LogLevel::Error>(
-                        STR("[AsyncWorker] Task error: {}\n"),
-                        StringConv::ToWide(e.what())
-                    );
-                }
+
+            try {
+                owned->task();
+            } catch (const std::exception& e) {
+                RC::Output::send<RC::LogLevel::Error>(
+                    STR("[GameThreadQueue] Task error: {}\n"),
+                    StringConv::ToWide(e.what())
+                );
+            } catch (...) {
+                RC::Output::send<RC::LogLevel::Error>(STR("[GameThreadQueue] Task error: unknown exception\n"));
             }
+            ++ran;
+
+            if (std::chrono::steady_clock::now() >= deadline) break;
         }
+        return ran;
     }
-    
-    std::queue<std::function<void()>> task_queue_;
-    std::mutex queue_mutex_;
-    std::condition_variable cv_;
-    std::atomic<bool> shutdown_;
-    std::unique_ptr<std::jthread> worker_thread_;
+
+    /// Awaitable that resumes a coroutine from the next drain()
+    auto schedule() {
+        struct Awaiter {
+            GameThreadQueue& queue;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { queue.post([handle] { handle.resume(); }); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{*this};
+    }
+
+    /// Approximate number of queued tasks
+    size_t pending() const {
+        return pending_.load(std::memory_order_relaxed);
+    }
+
+    /// Number of tasks dropped because their actor died or was never tracked
+    size_t dropped() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next;
+        Task task;
+        const RC::Unreal::UObjectBase* target;
+        RC::Unreal::int32 index;
+        uint32_t serial;
+    };
+
+    /// Vyukov MPSC push: one exchange, then link the previous head to the new node
+    void push(Node* node) {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        Node* previous = head_.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /// Single consumer pop, returns the oldest node (owned by the caller) or nullptr
+    /// The stub node is cycled back in whenever the list would otherwise become empty
+    Node* pop() {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (tail == &stub_) {
+            if (!next) return nullptr;
+            tail_ = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next) {
+            tail_ = next;
+            return tail;
+        }
+
+        // tail is the last linked node; a producer may be between its exchange and link
+        if (tail != head_.load(std::memory_order_acquire)) return nullptr;
+
+        // Re-insert the stub behind it so tail can be handed out
+        stub_.next.store(nullptr, std::memory_order_relaxed);
+        push_stub();
+        next = tail->next.load(std::memory_order_acquire);
+        if (next) {
+            tail_ = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+    void push_stub() {
+        Node* previous = head_.exchange(&stub_, std::memory_order_acq_rel);
+        previous->next.store(&stub_, std::memory_order_release);
+    }
+
+    Node stub_{{nullptr}, {}, nullptr, INDEX_NONE, 0};
+    std::atomic<Node*> head_;
+    Node* tail_;
+    std::atomic<size_t> pending_{0};
+    std::atomic<size_t> dropped_{0};
 };
 
+/// Awaitable that continues a coroutine on the game thread, from the next GameThreadQueue drain
+/// Awaiting it on the game thread yields until the next frame, for frame-sliced jobs
+inline auto game_thread() {
+    return GameThreadQueue::get().schedule();
+}
+
 class SafeCall {
 public:
     template<typename Callable>
@@ -159,54 +1793,347 @@ private:
     size_t size_;
 };
 
+/// Offset of a hook parameter in a UFunction's locals, resolved once
+struct HookBinding {
+    RC::Unreal::int32 offset{INDEX_NONE};   ///< INDEX_NONE if missing or of the wrong type
+    FieldKind kind{FieldKind::Other};
+
+    /// Pack with the tracker serial of the function it was resolved against, for inline caches
+    /// Parameter frames are far below 16 MB, so the offset takes the low 24 bits
+    uint64_t Pack(uint32_t serial) const {
+        const uint32_t packedOffset = offset == INDEX_NONE ? OffsetNone : static_cast<uint32_t>(offset) & OffsetNone;
+        return (static_cast<uint64_t>(serial) << 32) | (static_cast<uint64_t>(kind) << 24) | packedOffset;
+    }
+
+    static HookBinding Unpack(uint64_t packed) {
+        const uint32_t packedOffset = static_cast<uint32_t>(packed) & OffsetNone;
+        return {packedOffset == OffsetNone ? INDEX_NONE : static_cast<RC::Unreal::int32>(packedOffset),
+                static_cast<FieldKind>((packed >> 24) & 0xFF)};
+    }
+
+    static uint32_t Serial(uint64_t packed) {
+        return static_cast<uint32_t>(packed >> 32);
+    }
+
+private:
+    static constexpr uint32_t OffsetNone = 0xFFFFFF;
+};
+
+/// Process-wide cache of hook parameter offsets by (UFunction, parameter name, expected type)
+///
+/// Each function's entries remember the serial ObjectLifetimeTracker::WatchObject() gave the
+/// function and only match while the function still holds it, so a UFunction unloaded with
+/// its class and another allocated at the same address resolves again. The entries of a
+/// deleted function are freed once the deletion is delivered through ProcessPendingEvents().
+class HookParamCache {
+public:
+    static HookParamCache& Get() {
+        static HookParamCache instance;
+        return instance;
+    }
+
+    /// Find or resolve a parameter binding
+    /// @param function The hooked function
+    /// @param name The parameter name
+    /// @param hash HashFieldName(name)
+    /// @param expectedKind Kind the caller reads the parameter as, Other to accept any
+    /// @param expectedSize Size the caller reads, 0 to accept any
+    /// @return The binding packed with the function's serial, see HookBinding::Pack()
+    uint64_t Lookup(RC::Unreal::UFunction* function, const wchar_t* name, uint64_t hash,
+                    FieldKind expectedKind = FieldKind::Other, size_t expectedSize = 0) {
+        if (!function) return HookBinding{}.Pack(0);
+
+        const uint64_t typedHash = hash ^ (static_cast<uint64_t>(expectedKind) << 56) ^ expectedSize;
+        {
+            std::shared_lock lock(cacheLock);
+            auto owner = functions.find(function);
+            if (owner != functions.end() && ObjectLifetimeTracker::Get().IsCurrent(function, owner->second)) {
+                auto it = bindings.find(KeyView{function, typedHash, name});
+                if (it != bindings.end()) {
+                    return it->second.Pack(owner->second);
+                }
+            }
+        }
+
+        HookBinding resolved;
+        for (RC::Unreal::FProperty* property : function->ForEachPropertyInChain()) {
+            if (property->GetName() != name) continue;
+
+            resolved.kind = FieldKindOf(property);
+            const bool kindMatches = expectedKind == FieldKind::Other || resolved.kind == FieldKind::Other ||
+                                     expectedKind == resolved.kind;
+            const bool sizeMatches = expectedSize == 0 ||
+                                     static_cast<size_t>(property->GetElementSize()) == expectedSize;
+            if (kindMatches && sizeMatches) {
+                resolved.offset = property->GetOffset_Internal();
+            } else {
+                RC::Output::send<RC::LogLevel::Warning>(
+                    STR("[HookUtil] {} parameter {} is a {} byte {}, not the {} byte type it is read as\n"),
+                    function->GetName(), name, property->GetElementSize(),
+                    property->GetClass().GetFName().ToString(), expectedSize);
+            }
+            break;
+        }
+
+        // Nothing would report an unregistered function unloading, so don't keep entries for it
+        const uint32_t serial = ObjectLifetimeTracker::Get().WatchObject(function);
+        if (serial == 0) return resolved.Pack(0);
+
+        std::unique_lock lock(cacheLock);
+        auto [owner, inserted] = functions.try_emplace(function, serial);
+        if (!inserted && owner->second != serial) {
+            // Left over from an unloaded function at the same address
+            EraseBindings(function);
+            owner->second = serial;
+        }
+        bindings.insert_or_assign(Key{function, typedHash, name}, resolved);
+        return resolved.Pack(serial);
+    }
+
+    /// Drop every binding
+    void Clear() {
+        std::unique_lock lock(cacheLock);
+        bindings.clear();
+        functions.clear();
+    }
+
+private:
+    struct Key {
+        const RC::Unreal::UFunction* function;
+        uint64_t hash;
+        std::wstring name;
+    };
+
+    /// Non-owning key so lookups don't build a std::wstring
+    struct KeyView {
+        const RC::Unreal::UFunction* function;
+        uint64_t hash;
+        std::wstring_view name;
+
+        KeyView(const RC::Unreal::UFunction* keyFunction, uint64_t keyHash, std::wstring_view keyName)
+            : function(keyFunction), hash(keyHash), name(keyName) {}
+        KeyView(const Key& key) : function(key.function), hash(key.hash), name(key.name) {}
+    };
+
+    struct KeyHash {
+        using is_transparent = void;
+        size_t operator()(KeyView key) const noexcept {
+            return static_cast<size_t>(key.hash) ^ (std::hash<const void*>{}(key.function) << 1);
+        }
+    };
+
+    struct KeyEqual {
+        using is_transparent = void;
+        bool operator()(KeyView lhs, KeyView rhs) const noexcept {
+            return lhs.hash == rhs.hash && lhs.function == rhs.function && lhs.name == rhs.name;
+        }
+    };
+
+    std::unordered_map<Key, HookBinding, KeyHash, KeyEqual> bindings;
+    std::unordered_map<const RC::Unreal::UFunction*, uint32_t> functions;   ///< Serial of each function with bindings
+    std::shared_mutex cacheLock;
+    ObjectLifetimeTracker::SubscriptionId watcher{0};
+
+    /// cacheLock must be held exclusively
+    void EraseBindings(const RC::Unreal::UFunction* function) {
+        std::erase_if(bindings, [function](const auto& entry) {
+            return entry.first.function == function;
+        });
+    }
+
+    /// Only the address of the deleted function is used, it's dangling by now
+    void OnFunctionDeleted(const RC::Unreal::UObjectBase* object, uint32_t serial) {
+        if (!object) {
+            Clear();
+            return;
+        }
+
+        const auto* function = reinterpret_cast<const RC::Unreal::UFunction*>(object);
+        std::unique_lock lock(cacheLock);
+        auto owner = functions.find(function);
+        if (owner == functions.end() || (serial != 0 && owner->second != serial)) return;
+
+        functions.erase(owner);
+        EraseBindings(function);
+    }
+
+    HookParamCache() {
+        watcher = ObjectLifetimeTracker::Get().AddDeleteWatcher(
+            [this](const RC::Unreal::UObjectBase* object, uint32_t serial) { OnFunctionDeleted(object, serial); });
+    }
+
+    ~HookParamCache() {
+        ObjectLifetimeTracker::Get().RemoveDeleteWatcher(watcher);
+    }
+
+    // Prevent copies
+    HookParamCache(const HookParamCache&) = delete;
+    HookParamCache& operator=(const HookParamCache&) = delete;
+};
+
+/// Hook parameter handle with an inline cache of its binding
+///
+/// Declare one per parameter, typically static, and read it inside the hook. After the first
+/// call for a UFunction, Bind() is a serial check with no hashing and no lock. Untyped, for
+/// parameters read through HookUtil whose type varies, such as names and strings.
+///
+/// Example usage:
+/// @code
+/// static const HookParamHandle chatter{STR("Chatter")};
+/// auto username = HookUtil::ExtractParamAsString(ctx, chatter);
+/// @endcode
+class HookParamHandle {
+public:
+    /// @param name The parameter name, must outlive the handle
+    /// @param expectedKind Kind the parameter is read as, Other to accept any
+    /// @param expectedSize Size the parameter is read as, 0 to accept any
+    explicit HookParamHandle(const wchar_t* name, FieldKind expectedKind = FieldKind::Other,
+                             size_t expectedSize = 0)
+        : name_(name), hash_(HashFieldName(name)), kind_(expectedKind), size_(expectedSize) {}
+
+    /// Get the binding for the current call's function
+    /// @return The binding; offset is INDEX_NONE if the parameter is missing
+    HookBinding Bind(RC::Unreal::UnrealScriptFunctionCallableContext& ctx) const {
+        RC::Unreal::UFunction* function = ctx.TheStack.Node();
+
+        uint64_t binding = hint_.load(std::memory_order_acquire);
+        if (!ObjectLifetimeTracker::Get().IsCurrent(function, HookBinding::Serial(binding))) {
+            binding = HookParamCache::Get().Lookup(function, name_, hash_, kind_, size_);
+            hint_.store(binding, std::memory_order_release);
+        }
+        return HookBinding::Unpack(binding);
+    }
+
+    /// Get a pointer to the parameter in the current call's locals
+    /// @return nullptr if the function has no such parameter or it has the wrong type
+    void* GetRaw(RC::Unreal::UnrealScriptFunctionCallableContext& ctx) const {
+        const HookBinding binding = Bind(ctx);
+        if (binding.offset == INDEX_NONE) return nullptr;
+        return ctx.TheStack.Locals() + binding.offset;
+    }
+
+    const wchar_t* GetName() const { return name_; }
+
+private:
+    const wchar_t* name_;
+    uint64_t hash_;
+    FieldKind kind_;
+    size_t size_;
+    mutable std::atomic<uint64_t> hint_{0};    ///< Last binding, packed by HookBinding::Pack()
+};
+
+/// Typed hook parameter with an inline cache of its offset
+///
+/// Declare one per parameter, typically static, and read it inside the hook. After the first
+/// call for a UFunction, Get() is a serial check and an add on the stack's locals.
+///
+/// Example usage:
+/// @code
+/// static const HookParam<float> amount{STR("Amount")};
+/// if (float* value = amount.Get(ctx)) { ... }
+/// @endcode
+template<typename T>
+class HookParam : public HookParamHandle {
+public:
+    explicit HookParam(const wchar_t* name) : HookParamHandle(name, FieldKindOf<T>(), sizeof(T)) {}
+
+    /// Get a pointer to the parameter in the current call's locals
+    /// @return nullptr if the function has no such parameter or it isn't a T
+    T* Get(RC::Unreal::UnrealScriptFunctionCallableContext& ctx) const {
+        return static_cast<T*>(GetRaw(ctx));
+    }
+
+    /// Copy the parameter's value
+    std::optional<T> Read(RC::Unreal::UnrealScriptFunctionCallableContext& ctx) const {
+        if (T* value = Get(ctx)) return *value;
+        return std::nullopt;
+    }
+};
+
+/// Read hook parameters by name
+///
+/// The overloads taking a parameter name look the name up in HookParamCache on every call,
+/// which hashes the name and takes a shared lock. In hot hooks, declare a static
+/// HookParamHandle or HookParam<T> and pass that instead; it resolves once per function.
 class HookUtil {
 public:
+    /// Read a name or string parameter as UTF-8
+    /// Supports FName, FString and FText parameters
     static std::optional<std::string> ExtractParamAsString(
         RC::Unreal::UnrealScriptFunctionCallableContext& ctx,
         const wchar_t* param_name)
+    {
+        return ExtractParamAsString(ctx, HookParamHandle(param_name));
+    }
+
+    /// Read a name or string parameter as UTF-8, through a handle resolved once
+    static std::optional<std::string> ExtractParamAsString(
+        RC::Unreal::UnrealScriptFunctionCallableContext& ctx,
+        const HookParamHandle& param)
     {
         using namespace RC::Unreal;
-        
-        UFunction* function = ctx.TheStack.Node();
-        if (!function) return std::nullopt;
-        
-        for (FProperty* property : function->ForEachPropertyInChain())
-        {
-            if (property->GetFName() == FName(param_name))
-            {
-                void* valuePtr = property->ContainerPtrToValuePtr<void>(ctx.TheStack.Locals());
-                if (!valuePtr) return std::nullopt;
-                
-                FName fname = *static_cast<FName*>(valuePtr);
-                std::wstring wstr = fname.ToString();
-                return StringConv::ToNarrow(wstr);
-            }
+
+        const HookBinding binding = param.Bind(ctx);
+        if (binding.offset == INDEX_NONE) return std::nullopt;
+
+        void* valuePtr = ctx.TheStack.Locals() + binding.offset;
+        switch (binding.kind) {
+        case FieldKind::Name:
+            return std::string(FNameStringCache::Get().ToUtf8(*static_cast<FName*>(valuePtr)));
+        case FieldKind::String:
+            return StringConv::ToNarrow(static_cast<FString*>(valuePtr)->GetCharArray());
+        case FieldKind::Text:
+            return StringConv::ToNarrow(static_cast<FText*>(valuePtr)->ToString());
+        default:
+            return std::nullopt;
         }
-        
-        return std::nullopt;
     }
     
+    /// Read an FName parameter as interned UTF-8, without allocating after the first call per name
+    /// @return View valid for the process lifetime
+    static std::optional<std::string_view> ExtractNameView(
+        RC::Unreal::UnrealScriptFunctionCallableContext& ctx,
+        const wchar_t* param_name)
+    {
+        auto name = ExtractParam<RC::Unreal::FName>(ctx, param_name);
+        if (!name) return std::nullopt;
+        return FNameStringCache::Get().ToUtf8(*name);
+    }
+
+    /// Read an FName parameter as interned UTF-8, through a handle resolved once
+    static std::optional<std::string_view> ExtractNameView(
+        RC::Unreal::UnrealScriptFunctionCallableContext& ctx,
+        const HookParam<RC::Unreal::FName>& param)
+    {
+        RC::Unreal::FName* name = param.Get(ctx);
+        if (!name) return std::nullopt;
+        return FNameStringCache::Get().ToUtf8(*name);
+    }
+
     static std::optional<RC::Unreal::FName> ExtractFNameParam(
         RC::Unreal::UnrealScriptFunctionCallableContext& ctx,
         const wchar_t* param_name)
     {
-        using namespace RC::Unreal;
-        
-        UFunction* function = ctx.TheStack.Node();
-        if (!function) return std::nullopt;
-        
-        for (FProperty* property : function->ForEachPropertyInChain())
-        {
-            if (property->GetFName() == FName(param_name))
-            {
-                void* valuePtr = property->ContainerPtrToValuePtr<void>(ctx.TheStack.Locals());
-                if (!valuePtr) return std::nullopt;
-                
-                return *static_cast<FName*>(valuePtr);
-            }
-        }
-        
-        return std::nullopt;
+        return ExtractParam<RC::Unreal::FName>(ctx, param_name);
+    }
+
+    /// Read a parameter of any type by name
+    /// The offset is cached per function; prefer a static HookParam<T> in hot hooks
+    template<typename T>
+    static std::optional<T> ExtractParam(
+        RC::Unreal::UnrealScriptFunctionCallableContext& ctx,
+        const wchar_t* param_name)
+    {
+        return HookParam<T>(param_name).Read(ctx);
+    }
+
+    /// Read a parameter through a handle resolved once
+    template<typename T>
+    static std::optional<T> ExtractParam(
+        RC::Unreal::UnrealScriptFunctionCallableContext& ctx,
+        const HookParam<T>& param)
+    {
+        return param.Read(ctx);
     }
 };
 
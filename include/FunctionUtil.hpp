@@ -4,8 +4,25 @@
 #include <Unreal/AActor.hpp>
 #include <Unreal/FMemory.hpp>
 #include <DynamicOutput/Output.hpp>
+#include "StructUtil.hpp"
+#include "ObjectLifetimeTracker.hpp"
+#include <array>
+#include <atomic>
 #include <bit>
-#include <malloc.h>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <memory>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <shared_mutex>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace votv::util {
 
@@ -15,25 +32,719 @@ using RC::Unreal::AActor;
 using RC::Unreal::FName;
 using RC::Unreal::FMemory;
 using RC::Unreal::UClass;
+using RC::Unreal::FProperty;
+
+/// A UFunction call with its parameter layout resolved once
+///
+/// Parameter offsets, sizes and the return value offset are looked up when the call is
+/// prepared. The parameter buffer is zeroed once and reused, so each call only writes the
+/// bound parameters and runs ProcessEvent.
+///
+/// @note Not thread-safe and not reentrant: the buffer is shared between calls.
+///       Keep one per thread, or use FunctionUtil::Prepare() which caches per thread and
+///       never hands out an instance that is still leased, e.g. to a nested call made from
+///       inside Invoke().
+/// @note Parameters keep the value of the previous call until overwritten; set every
+///       parameter the function reads before each Invoke(), or Reset() the frame first.
+class PreparedCall {
+public:
+    struct ParamBinding {
+        std::wstring name;
+        FProperty* property;
+        RC::Unreal::int32 offset;
+        RC::Unreal::int32 size;
+    };
+
+    PreparedCall() = default;
+
+    /// Resolve a function's parameters
+    /// @param function The UFunction to call
+    /// @param param_names Parameter names, bound by position in Set()/Param()
+    /// @param return_name Name of the return value property, may not exist
+    PreparedCall(UFunction* function, std::initializer_list<const wchar_t*> param_names,
+                 const wchar_t* return_name = STR("ReturnValue"))
+        : PreparedCall(function, std::span(param_names.begin(), param_names.size()), return_name) {}
+
+    PreparedCall(UFunction* function, std::span<const wchar_t* const> param_names,
+                 const wchar_t* return_name = STR("ReturnValue"))
+        : function_(function), return_name_(return_name ? return_name : STR("")) {
+        if (!function_) return;
+
+        names_.assign(param_names.begin(), param_names.end());
+        params_.reserve(param_names.size());
+        for (const wchar_t* name : param_names) {
+            auto property = function_->FindProperty(FName(name));
+            if (!property) {
+                RC::Output::send<RC::LogLevel::Warning>(
+                    STR("[PreparedCall] {} has no parameter {}\n"), function_->GetName(), name);
+                return;
+            }
+            params_.push_back({name, property, property->GetOffset_Internal(), property->GetElementSize()});
+        }
+
+        if (return_name) {
+            auto return_property = function_->FindProperty(FName(return_name));
+            if (return_property && return_property->GetOffset_Internal() != INDEX_NONE) {
+                return_offset_ = return_property->GetOffset_Internal();
+                return_size_ = return_property->GetElementSize();
+            }
+        }
+
+        // Whole 16-byte blocks keep the buffer aligned for any parameter type
+        buffer_.resize((static_cast<size_t>(function_->GetParmsSize()) + sizeof(Block) - 1) / sizeof(Block));
+        valid_ = true;
+    }
+
+    bool IsValid() const { return valid_; }
+    UFunction* GetFunction() const { return function_; }
+    size_t ParamCount() const { return params_.size(); }
+    const ParamBinding& GetParam(size_t index) const { return params_[index]; }
+    bool HasReturnValue() const { return return_offset_ != INDEX_NONE; }
+
+    /// Whether Invoke() is running, e.g. this call is further up the stack of a nested call
+    bool IsBusy() const { return busy_; }
+
+    /// Get a parameter's storage in the buffer
+    /// @return Pointer to the value, or nullptr if the index is out of range or T is larger than the property
+    template<typename T>
+    T* Param(size_t index) {
+        if (index >= params_.size() || sizeof(T) > static_cast<size_t>(params_[index].size)) return nullptr;
+        return std::bit_cast<T*>(Data() + params_[index].offset);
+    }
+
+    /// Write a parameter by position
+    /// @return false if the index is out of range or T is larger than the property
+    template<typename T>
+    bool Set(size_t index, const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "PreparedCall parameters are raw buffer writes");
+        T* ptr = Param<T>(index);
+        if (!ptr) return false;
+        *ptr = value;
+        return true;
+    }
+
+    /// Zero the whole parameter frame, including out-params and the return value
+    /// Only for frames holding trivially destructible values, anything else must be Release()d first
+    void Reset() {
+        std::memset(static_cast<void*>(buffer_.data()), 0, buffer_.size() * sizeof(Block));
+    }
+
+    /// Run the function on an object with the current parameter values
+    bool Invoke(UObject* object) {
+        if (!object || !valid_) return false;
+
+        busy_ = true;
+        try {
+            object->ProcessEvent(function_, Data());
+            busy_ = false;
+            return true;
+        } catch (...) {
+            busy_ = false;
+            return false;
+        }
+    }
+
+    /// Read the return value written by the last Invoke()
+    /// @return Pointer to the value, or nullptr if there is none or T is larger than it
+    template<typename T>
+    const T* GetReturnValue() const {
+        if (return_offset_ == INDEX_NONE || sizeof(T) > static_cast<size_t>(return_size_)) return nullptr;
+        return std::bit_cast<const T*>(Data() + return_offset_);
+    }
+
+    /// Check that parameters and return value have the C++ types of a call signature
+    /// Compares each property's kind and element size; a failed check invalidates the call
+    /// @tparam R Return type, void to skip the check
+    /// @tparam Ts Parameter types, in the order the names were given
+    /// @return true if every type matches
+    template<typename R, typename... Ts>
+    bool CheckSignature() {
+        if (!valid_) return false;
+        if (sizeof...(Ts) != params_.size()) {
+            valid_ = false;
+            return false;
+        }
+
+        size_t index = 0;
+        bool ok = (CheckType<Ts>(params_[index++]) && ...);
+        if constexpr (!std::is_void_v<R>) {
+            if (return_offset_ == INDEX_NONE || static_cast<size_t>(return_size_) != sizeof(R)) {
+                RC::Output::send<RC::LogLevel::Warning>(
+                    STR("[PreparedCall] {} return value doesn't match a {} byte type\n"),
+                    function_->GetName(), sizeof(R));
+                ok = false;
+            }
+        }
+
+        valid_ = ok;
+        return ok;
+    }
+
+    /// Write a parameter of a checked signature, constructing non-trivial types in place
+    /// @note Pair with Release() after the call for types that own memory
+    template<typename T>
+    void Write(size_t index, const T& value) {
+        void* ptr = Data() + params_[index].offset;
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            std::memcpy(ptr, &value, sizeof(T));
+        } else {
+            new (ptr) T(value);
+        }
+    }
+
+    /// Destroy a parameter written by Write() and restore the zeroed bytes
+    template<typename T>
+    void Release(size_t index) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            auto ptr = std::bit_cast<T*>(Data() + params_[index].offset);
+            ptr->~T();
+            std::memset(static_cast<void*>(ptr), 0, sizeof(T));
+        }
+    }
+
+    /// Move the return value of a checked signature out of the buffer
+    template<typename R>
+    R TakeReturnValue() {
+        auto ptr = std::bit_cast<R*>(Data() + return_offset_);
+        R result = std::move(*ptr);
+        if constexpr (!std::is_trivially_destructible_v<R>) {
+            ptr->~R();
+            std::memset(static_cast<void*>(ptr), 0, sizeof(R));
+        }
+        return result;
+    }
+
+    /// Check whether this call was prepared for a function and name list
+    /// A call whose preparation failed still matches, so failures are cached too
+    bool Matches(UFunction* function, std::span<const wchar_t* const> param_names,
+                 const wchar_t* return_name = STR("ReturnValue")) const {
+        if (function != function_ || param_names.size() != names_.size()) return false;
+        if (return_name_ != (return_name ? return_name : STR(""))) return false;
+
+        size_t i = 0;
+        for (const wchar_t* name : param_names) {
+            if (names_[i++] != name) return false;
+        }
+        return true;
+    }
+
+private:
+    struct alignas(16) Block { std::byte bytes[16]; };
+
+    template<typename T>
+    bool CheckType(const ParamBinding& param) const {
+        FProperty* property = param.property;
+        const FieldKind expected = FieldKindOf<T>();
+        const FieldKind actual = FieldKindOf(property);
+        const bool kindMatches = expected == FieldKind::Other || actual == FieldKind::Other || expected == actual;
+
+        if (!kindMatches || static_cast<size_t>(property->GetElementSize()) != sizeof(T)) {
+            RC::Output::send<RC::LogLevel::Warning>(
+                STR("[PreparedCall] {} parameter {} is a {} byte {}, not a {} byte argument\n"),
+                function_->GetName(), param.name, property->GetElementSize(),
+                property->GetClass().GetFName().ToString(), sizeof(T));
+            return false;
+        }
+        return true;
+    }
+
+    RC::Unreal::uint8* Data() { return std::bit_cast<RC::Unreal::uint8*>(buffer_.data()); }
+    const RC::Unreal::uint8* Data() const { return std::bit_cast<const RC::Unreal::uint8*>(buffer_.data()); }
+
+    UFunction* function_{nullptr};
+    std::wstring return_name_;
+    std::vector<std::wstring> names_;
+    std::vector<ParamBinding> params_;
+    RC::Unreal::int32 return_offset_{INDEX_NONE};
+    RC::Unreal::int32 return_size_{0};
+    std::vector<Block> buffer_;
+    bool valid_{false};
+    bool busy_{false};
+};
+
+/// Exclusive handle to a PreparedCall cached by FunctionUtil::Prepare()
+///
+/// Keeps the call alive and reserved while held: Prepare() hands every other caller,
+/// including nested calls, a different instance, and dropping the cache after a function
+/// was deleted doesn't free a leased call. Release it once the call is done; holding it
+/// doesn't keep the UFunction loaded.
+class PreparedCallLease {
+public:
+    PreparedCallLease() = default;
+    explicit PreparedCallLease(std::shared_ptr<PreparedCall> call) : call_(std::move(call)) {}
+
+    PreparedCallLease(PreparedCallLease&&) noexcept = default;
+    PreparedCallLease& operator=(PreparedCallLease&&) noexcept = default;
+    PreparedCallLease(const PreparedCallLease&) = delete;
+    PreparedCallLease& operator=(const PreparedCallLease&) = delete;
+
+    PreparedCall* operator->() const { return call_.get(); }
+    PreparedCall& operator*() const { return *call_; }
+    PreparedCall* Get() const { return call_.get(); }
+    explicit operator bool() const { return call_ != nullptr; }
+
+    /// Return the call to the cache early
+    void Release() { call_.reset(); }
+
+private:
+    std::shared_ptr<PreparedCall> call_;
+};
+
+/// Process-wide cache of UFunction lookups by (UClass, function name)
+///
+/// Stores misses as well as hits, so a function that doesn't exist is only searched for once.
+/// Each class's entries remember the serial ObjectLifetimeTracker::WatchObject() gave the
+/// class, and a lookup only hits while the class still holds it, so a class unloaded and
+/// another loaded at its address never sees the old entries. Watched classes stay out of
+/// the tracker's Find* results and subscriptions; their entries are freed once the deletion
+/// is delivered through ProcessPendingEvents().
+class FunctionCache {
+public:
+    static FunctionCache& Get() {
+        static FunctionCache instance;
+        return instance;
+    }
+
+    /// Get a cached lookup
+    /// @param object_class The class of a live object
+    /// @param found Set to whether the (class, name) pair is cached
+    /// @return The cached function, nullptr for a cached miss
+    UFunction* Find(UClass* object_class, const wchar_t* function_name, bool& found) {
+        std::shared_lock lock(cache_lock_);
+        found = false;
+        auto owner = classes_.find(object_class);
+        if (owner == classes_.end() || !ObjectLifetimeTracker::Get().IsCurrent(object_class, owner->second)) {
+            return nullptr;
+        }
+
+        auto it = functions_.find(KeyView{object_class, HashFieldName(function_name), function_name});
+        found = it != functions_.end();
+        return found ? it->second : nullptr;
+    }
+
+    /// Record a lookup result, nullptr records a miss
+    /// @param object_class The class of a live object
+    void Store(UClass* object_class, const wchar_t* function_name, UFunction* function) {
+        if (!object_class) return;
+
+        // Nothing would report an unregistered class unloading, so don't keep entries for it
+        const uint32_t serial = ObjectLifetimeTracker::Get().WatchObject(object_class);
+        if (serial == 0) return;
+
+        std::unique_lock lock(cache_lock_);
+        auto [owner, inserted] = classes_.try_emplace(object_class, serial);
+        if (!inserted && owner->second != serial) {
+            // Left over from an unloaded class at the same address
+            EraseFunctions(object_class);
+            owner->second = serial;
+        }
+        functions_.insert_or_assign(Key{object_class, HashFieldName(function_name), function_name}, function);
+    }
+
+    /// Resolve a list of functions on a class with a single walk of its function chain
+    /// @param object_class The class to search
+    /// @param function_names Names to resolve, misses are cached too
+    /// @return Number of functions found
+    size_t Prefetch(UClass* object_class, std::initializer_list<const wchar_t*> function_names) {
+        if (!object_class) return 0;
+
+        std::vector<const wchar_t*> pending;
+        std::vector<UFunction*> results;
+        size_t found_count = 0;
+        for (const wchar_t* name : function_names) {
+            bool found = false;
+            if (Find(object_class, name, found)) ++found_count;
+            if (!found) pending.push_back(name);
+        }
+        if (pending.empty()) return found_count;
+
+        results.resize(pending.size(), nullptr);
+        for (UFunction* function : object_class->ForEachFunctionInChain()) {
+            const auto function_name = function->GetName();
+            for (size_t i = 0; i < pending.size(); ++i) {
+                // The first match in the chain wins, as in FindFunction
+                if (!results[i] && function_name == pending[i]) {
+                    results[i] = function;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < pending.size(); ++i) {
+            Store(object_class, pending[i], results[i]);
+            if (results[i]) ++found_count;
+        }
+        return found_count;
+    }
+
+    /// Drop every lookup cached for a class
+    void Invalidate(const UClass* object_class) {
+        std::unique_lock lock(cache_lock_);
+        if (classes_.erase(object_class)) {
+            EraseFunctions(object_class);
+        }
+    }
+
+    /// Drop every cached lookup
+    void Clear() {
+        std::unique_lock lock(cache_lock_);
+        functions_.clear();
+        classes_.clear();
+    }
+
+private:
+    struct Key {
+        const UClass* owner;
+        uint64_t hash;
+        std::wstring name;
+    };
+
+    /// Non-owning key so lookups don't build a std::wstring
+    struct KeyView {
+        const UClass* owner;
+        uint64_t hash;
+        std::wstring_view name;
+
+        KeyView(const UClass* key_owner, uint64_t key_hash, std::wstring_view key_name)
+            : owner(key_owner), hash(key_hash), name(key_name) {}
+        KeyView(const Key& key) : owner(key.owner), hash(key.hash), name(key.name) {}
+    };
+
+    struct KeyHash {
+        using is_transparent = void;
+        size_t operator()(KeyView key) const noexcept {
+            return static_cast<size_t>(key.hash) ^ (std::hash<const void*>{}(key.owner) << 1);
+        }
+    };
+
+    struct KeyEqual {
+        using is_transparent = void;
+        bool operator()(KeyView lhs, KeyView rhs) const noexcept {
+            return lhs.hash == rhs.hash && lhs.owner == rhs.owner && lhs.name == rhs.name;
+        }
+    };
+
+    /// cache_lock_ must be held exclusively
+    void EraseFunctions(const UClass* object_class) {
+        std::erase_if(functions_, [object_class](const auto& entry) {
+            return entry.first.owner == object_class;
+        });
+    }
+
+    /// Only the address of the deleted class is used, it's dangling by now
+    void OnClassDeleted(const RC::Unreal::UObjectBase* object, uint32_t serial) {
+        if (!object) {
+            Clear();
+            return;
+        }
+
+        const auto object_class = reinterpret_cast<const UClass*>(object);
+        std::unique_lock lock(cache_lock_);
+        auto owner = classes_.find(object_class);
+        if (owner == classes_.end() || (serial != 0 && owner->second != serial)) return;
+
+        classes_.erase(owner);
+        EraseFunctions(object_class);
+    }
+
+    std::unordered_map<Key, UFunction*, KeyHash, KeyEqual> functions_;
+    std::unordered_map<const UClass*, uint32_t> classes_;     ///< Serial of each class with entries
+    std::shared_mutex cache_lock_;
+    ObjectLifetimeTracker::SubscriptionId watcher_{0};
+
+    FunctionCache() {
+        watcher_ = ObjectLifetimeTracker::Get().AddDeleteWatcher(
+            [this](const RC::Unreal::UObjectBase* object, uint32_t serial) { OnClassDeleted(object, serial); });
+    }
+
+    ~FunctionCache() {
+        ObjectLifetimeTracker::Get().RemoveDeleteWatcher(watcher_);
+    }
+
+    // Prevent copies
+    FunctionCache(const FunctionCache&) = delete;
+    FunctionCache& operator=(const FunctionCache&) = delete;
+};
+
+/// Named, typed argument for FunctionUtil::Invoke()
+template<typename T>
+struct Arg {
+    const wchar_t* name;
+    T value;
+
+    Arg(const wchar_t* name, T value) : name(name), value(std::move(value)) {}
+};
+
+/// Outcome of one object in FunctionUtil::InvokeBatch()
+enum class BatchStatus : uint8_t {
+    Failed,     ///< The function couldn't be prepared or ProcessEvent threw
+    Called,
+    Dead,       ///< Skipped, the object was null or destroyed
+};
+
+/// Per-object results of FunctionUtil::InvokeBatch(), indexed like the input objects
+template<typename R>
+struct BatchResult {
+    std::vector<BatchStatus> status;
+    std::vector<R> values;      ///< Return values, default constructed where not Called
+    size_t called{0};
+};
+
+template<>
+struct BatchResult<void> {
+    std::vector<BatchStatus> status;
+    size_t called{0};
+};
 
 class FunctionUtil {
 public:
+    /// Find a function on an object's class chain
+    /// Results, including misses, are cached per class by FunctionCache
     static UFunction* FindFunction(UObject* object, const wchar_t* function_name) {
         if (!object) return nullptr;
 
-        auto func = object->GetFunctionByName(function_name);
-        if (func) return func;
-
         UClass* object_class = object->GetClassPrivate();
-        if (!object_class) return nullptr;
+        if (!object_class) return object->GetFunctionByName(function_name);
 
-        for (UFunction* function : object_class->ForEachFunctionInChain()) {
-            if (function->GetName() == function_name) {
-                return function;
+        auto& cache = FunctionCache::Get();
+        bool found = false;
+        if (auto cached = cache.Find(object_class, function_name, found); found) {
+            return cached;
+        }
+
+        UFunction* result = object->GetFunctionByName(function_name);
+        if (!result) {
+            for (UFunction* function : object_class->ForEachFunctionInChain()) {
+                if (function->GetName() == function_name) {
+                    result = function;
+                    break;
+                }
+            }
+        }
+
+        cache.Store(object_class, function_name, result);
+        return result;
+    }
+
+    /// Resolve functions of a class up front, e.g. before installing hooks
+    /// @return Number of functions found
+    static size_t PrefetchFunctions(UClass* object_class, std::initializer_list<const wchar_t*> function_names) {
+        return FunctionCache::Get().Prefetch(object_class, function_names);
+    }
+
+    /// Lease the prepared call for a function and parameter list, cached per thread
+    /// @param function The UFunction to call, from the game thread while it's loaded
+    /// @param param_names Parameter names; names are compared by value, pointers needn't be stable
+    /// @param return_name Name of the return value property
+    /// @return Lease on the cached call, check IsValid() before use
+    /// @note A call stays reserved while its lease is held, so a nested Prepare() for the same
+    ///       function, e.g. from inside Invoke(), gets a separate instance
+    static PreparedCallLease Prepare(UFunction* function, std::initializer_list<const wchar_t*> param_names,
+                                     const wchar_t* return_name = STR("ReturnValue")) {
+        return Prepare(function, std::span(param_names.begin(), param_names.size()), return_name);
+    }
+
+    static PreparedCallLease Prepare(UFunction* function, std::span<const wchar_t* const> param_names,
+                                     const wchar_t* return_name = STR("ReturnValue")) {
+        thread_local PreparedCalls cache;
+
+        auto& variants = cache.For(function);
+        for (auto& call : variants) {
+            if (call.use_count() == 1 && call->Matches(function, param_names, return_name)) {
+                return PreparedCallLease(call);
+            }
+        }
+        return PreparedCallLease(cache.Add(variants, function, param_names, return_name));
+    }
+
+private:
+    /// Prepared calls of one thread, by function
+    /// Each function's calls remember the serial ObjectLifetimeTracker::WatchObject() gave the
+    /// function and are dropped once it no longer holds it. Leases share ownership, so a
+    /// dropped call stays valid until its lease is released.
+    class PreparedCalls {
+    public:
+        std::vector<std::shared_ptr<PreparedCall>>& For(UFunction* function) {
+            auto& tracker = ObjectLifetimeTracker::Get();
+            const uint64_t generation = tracker.WatchGeneration();
+            if (generation != generation_) {
+                generation_ = generation;
+                std::erase_if(calls_, [&tracker](const auto& entry) {
+                    return !tracker.IsAlive(entry.second.index, entry.second.serial);
+                });
             }
+
+            Entry& entry = calls_[function];
+            if (function && !tracker.IsCurrent(function, entry.serial)) {
+                // First use, or a different function allocated at a deleted one's address
+                entry.variants.clear();
+                entry.serial = tracker.WatchObject(function);
+                entry.index = function->GetInternalIndex();
+            }
+            return entry.variants;
+        }
+
+        std::shared_ptr<PreparedCall> Add(std::vector<std::shared_ptr<PreparedCall>>& variants, UFunction* function,
+                                          std::span<const wchar_t* const> param_names, const wchar_t* return_name) {
+            return variants.emplace_back(std::make_shared<PreparedCall>(function, param_names, return_name));
+        }
+
+    private:
+        struct Entry {
+            RC::Unreal::int32 index{INDEX_NONE};
+            uint32_t serial{0};     ///< Tracker serial of the function, 0 if it can't be watched
+            std::vector<std::shared_ptr<PreparedCall>> variants;
+        };
+
+        uint64_t generation_{0};
+        std::unordered_map<UFunction*, Entry> calls_;
+    };
+
+    template<typename R, typename Object, typename Generator, typename... Ts>
+    static BatchResult<R> InvokeBatchWith(UFunction* function, std::span<Object const> objects,
+                                          std::span<const wchar_t* const> param_names,
+                                          Generator& generator, std::tuple<Ts...>*) {
+        BatchResult<R> result;
+        result.status.assign(objects.size(), BatchStatus::Failed);
+        if constexpr (!std::is_void_v<R>) {
+            result.values.resize(objects.size());
+        }
+        if (!function) return result;
+
+        auto lease = PrepareTyped<R, Ts...>(function, param_names);
+        PreparedCall& call = *lease;
+        if (!call.IsValid()) return result;
+
+        auto& tracker = ObjectLifetimeTracker::Get();
+        for (size_t i = 0; i < objects.size(); ++i) {
+            UObject* object = LiveObject(tracker, objects[i]);
+            if (!object) {
+                result.status[i] = BatchStatus::Dead;
+                continue;
+            }
+
+            std::tuple<Ts...> args = generator(objects[i], i);
+            std::apply([&call](const Ts&... values) {
+                size_t index = 0;
+                (call.Write(index++, values), ...);
+            }, args);
+
+            if (call.Invoke(object)) {
+                result.status[i] = BatchStatus::Called;
+                ++result.called;
+                if constexpr (!std::is_void_v<R>) {
+                    result.values[i] = call.template TakeReturnValue<R>();
+                }
+            }
+
+            size_t index = 0;
+            (call.template Release<Ts>(index++), ...);
+        }
+        return result;
+    }
+
+    /// A raw pointer must not have been freed: one the listeners never saw is checked in GUObjectArray
+    template<typename T>
+    static UObject* LiveObject(const ObjectLifetimeTracker& tracker, T* object) {
+        // Objects created before the tracker was installed have no slot, ask GUObjectArray
+        if (!tracker.IsActorAlive(object) && !tracker.IsValidUObject(object)) return nullptr;
+        return object;
+    }
+
+    /// A handle is checked through its (index, serial) pair, without reading the object
+    template<typename T>
+    static UObject* LiveObject(const ObjectLifetimeTracker&, const TrackedPtr<T>& handle) {
+        return handle.Get();
+    }
+
+    /// Prepared call cache for one Invoke() signature, type-checked when first prepared
+    template<typename R, typename... Ts>
+    static PreparedCallLease PrepareTyped(UFunction* function, std::span<const wchar_t* const> param_names) {
+        thread_local PreparedCalls cache;
+
+        const wchar_t* return_name = std::is_void_v<R> ? nullptr : STR("ReturnValue");
+        auto& variants = cache.For(function);
+        for (auto& call : variants) {
+            if (call.use_count() == 1 && call->Matches(function, param_names, return_name)) {
+                return PreparedCallLease(call);
+            }
+        }
+
+        auto call = cache.Add(variants, function, param_names, return_name);
+        call->template CheckSignature<R, Ts...>();
+        return PreparedCallLease(std::move(call));
+    }
+
+public:
+
+    /// Call a function with typed arguments
+    /// Argument and return types are checked against the function's properties once per
+    /// function and name list, then arguments are written straight into the parameter frame.
+    /// @tparam R Return type, void if the function has none
+    /// @param object Object to call the function on
+    /// @param function The UFunction to call
+    /// @param args Arguments, e.g. Arg<float>(STR("Amount"), 1.f)
+    /// @return The return value, or std::nullopt on failure (bool success when R is void)
+    template<typename R = void, typename... Ts>
+    static auto Invoke(UObject* object, UFunction* function, const Arg<Ts>&... args)
+        -> std::conditional_t<std::is_void_v<R>, bool, std::optional<R>> {
+        using Result = std::conditional_t<std::is_void_v<R>, bool, std::optional<R>>;
+        if (!object || !function) return Result{};
+
+        const std::array<const wchar_t*, sizeof...(Ts)> names{args.name...};
+        auto lease = PrepareTyped<R, Ts...>(function, names);
+        PreparedCall& call = *lease;
+        if (!call.IsValid()) return Result{};
+
+        size_t index = 0;
+        (call.Write(index++, args.value), ...);
+
+        const bool ok = call.Invoke(object);
+
+        Result result{};
+        if constexpr (std::is_void_v<R>) {
+            result = ok;
+        } else if (ok) {
+            result = call.template TakeReturnValue<R>();
         }
 
-        return nullptr;
+        index = 0;
+        (call.template Release<Ts>(index++), ...);
+        return result;
+    }
+
+    /// Call a function on many objects with one prepared layout and parameter buffer
+    /// Objects that are null or destroyed according to ObjectLifetimeTracker or GUObjectArray
+    /// are skipped, without being tracked. Call from the game thread; raw pointers must be live
+    /// this frame, since one the listeners never saw is checked by reading its index. For
+    /// objects kept across frames pass TrackedPtr handles instead.
+    /// @tparam R Return type, void if the function has none
+    /// @param function The UFunction to call, shared by every object
+    /// @param objects Contiguous range of object pointers (vector, array, span)
+    /// @param param_names Parameter names, in the order the generator returns values
+    /// @param generator Called as generator(object, index), returns std::tuple of arguments
+    /// @return Status per object, plus return values when R isn't void
+    template<typename R = void, typename Range, typename Generator>
+    static BatchResult<R> InvokeBatch(UFunction* function, const Range& objects,
+                                      std::initializer_list<const wchar_t*> param_names,
+                                      Generator&& generator) {
+        using Object = std::ranges::range_value_t<Range>;
+        using Args = std::invoke_result_t<Generator&, Object, size_t>;
+        return InvokeBatchWith<R>(function, std::span(std::ranges::data(objects), std::ranges::size(objects)),
+                                  std::span(param_names.begin(), param_names.size()), generator,
+                                  static_cast<Args*>(nullptr));
+    }
+
+    /// Call a function on many objects kept as TrackedPtr handles
+    /// Each handle is checked with ObjectLifetimeTracker::IsAlive(index, serial), so objects
+    /// freed since the handles were taken are skipped without being read.
+    /// @param generator Called as generator(handle, index), returns std::tuple of arguments
+    template<typename R = void, typename T, typename Generator>
+    static BatchResult<R> InvokeBatch(UFunction* function, std::span<const TrackedPtr<T>> objects,
+                                      std::initializer_list<const wchar_t*> param_names,
+                                      Generator&& generator) {
+        using Args = std::invoke_result_t<Generator&, const TrackedPtr<T>&, size_t>;
+        return InvokeBatchWith<R>(function, objects, std::span(param_names.begin(), param_names.size()),
+                                  generator, static_cast<Args*>(nullptr));
     }
 
     static bool CallFunctionWithFName(AActor* actor, UFunction* function, 
@@ -41,24 +752,13 @@ public:
         if (!actor || !function) return false;
 
         try {
-            auto param_size = function->GetParmsSize();
-            auto param_data = static_cast<RC::Unreal::uint8*>(_malloca(param_size));
-            
-            FMemory::Memzero(param_data, param_size);
-            
-            auto property = function->FindProperty(FName(param_name));
-            if (!property) {
-                _freea(param_data);
-                return false;
-            }
-            
-            auto param = std::bit_cast<FName*>(&param_data[property->GetOffset_Internal()]);
-            *param = FName(value.c_str(), RC::Unreal::FNAME_Add);
-            
-            actor->ProcessEvent(function, param_data);
-            _freea(param_data);
-            
-            return true;
+            auto call = Prepare(function, {param_name});
+            if (!call->IsValid()) return false;
+
+            // Nothing from the previous call may leak into this one
+            call->Reset();
+            call->Set(0, FName(value.c_str(), RC::Unreal::FNAME_Add));
+            return call->Invoke(actor);
         } catch (...) {
             return false;
         }
@@ -76,33 +776,36 @@ public:
         if (!actor || !function) return false;
 
         try {
-            auto param_size = function->GetParmsSize();
-            auto param_data = static_cast<RC::Unreal::uint8*>(_malloca(param_size));
-            
-            FMemory::Memzero(param_data, param_size);
-            
+            // Names are bound in order, so one cached layout serves every call with this list
+            const wchar_t* short_names[16];
+            std::vector<const wchar_t*> long_names;
+            const wchar_t** names = short_names;
+            if (params.size() > std::size(short_names)) {
+                long_names.resize(params.size());
+                names = long_names.data();
+            }
+
+            size_t count = 0;
+            for (const auto& param : params) names[count++] = param.name;
+
+            auto call = Prepare(function, std::span<const wchar_t* const>(names, count),
+                                out_return ? return_name : nullptr);
+            if (!call->IsValid()) return false;
+
+            // Nothing from the previous call may leak into this one, including the return value
+            call->Reset();
+            size_t index = 0;
             for (const auto& param : params) {
-                auto property = function->FindProperty(FName(param.name));
-                if (!property) {
-                    _freea(param_data);
-                    return false;
-                }
-                
-                auto param_ptr = std::bit_cast<FName*>(&param_data[property->GetOffset_Internal()]);
-                *param_ptr = FName(param.value.c_str(), RC::Unreal::FNAME_Add);
+                call->Set(index++, FName(param.value.c_str(), RC::Unreal::FNAME_Add));
             }
-            
-            actor->ProcessEvent(function, param_data);
-            
+
+            if (!call->Invoke(actor)) return false;
+
             if (out_return) {
-                auto return_property = function->FindProperty(FName(return_name));
-                if (return_property && return_property->GetOffset_Internal() != INDEX_NONE) {
-                    auto ret_value = std::bit_cast<bool*>(&param_data[return_property->GetOffset_Internal()]);
+                if (auto ret_value = call->GetReturnValue<bool>()) {
                     *out_return = *ret_value;
                 }
             }
-            
-            _freea(param_data);
             return true;
         } catch (...) {
             return false;
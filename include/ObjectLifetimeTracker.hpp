@@ -1,7 +1,20 @@
 ﻿#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cwctype>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
 #include <unordered_map>
+#include <queue>
+#include <string_view>
+#include <vector>
 #include <unordered_set>
 #include <mutex>
+#include <shared_mutex>
 #include <DynamicOutput/Output.hpp>
 #include <Unreal/UObjectArray.hpp>
 #include <Unreal/UObject.hpp>
@@ -17,6 +30,271 @@ namespace RC::Unreal {
     class AGameModeBase;
 }
 
+/// A UObject creation or deletion reported by the UObjectArray listeners
+struct LifetimeEvent {
+    enum class Type : uint8_t { Created, Deleted };
+
+    Type type{Type::Created};
+    RC::Unreal::int32 index{0};
+    const RC::Unreal::UObjectBase* object{nullptr};
+    bool watched{false};            ///< A deleted object that was passed to WatchObject()
+    uint32_t serial{0};             ///< Serial the deleted object had, 0 if it wasn't in its slot
+};
+
+/// Bounded lock-free multi-producer, single-consumer queue of lifetime events
+///
+/// Producers (any thread allocating or freeing UObjects) never lock and never wait. Nodes live
+/// in chunks addressed by index and are recycled through a tagged free list, so the steady
+/// state doesn't touch the heap; a new chunk is only allocated when every node is in flight.
+/// Once the chunk table is full, events are dropped and counted instead, and the consumer is
+/// told through TakeOverflow() so it can resynchronize from another source. The consumer must
+/// be serialized by the caller.
+class LifetimeEventQueue {
+public:
+    LifetimeEventQueue() {
+        tail = Allocate();
+        Node(tail).next.store(Nil, std::memory_order_relaxed);
+        head.store(tail, std::memory_order_relaxed);
+    }
+
+    ~LifetimeEventQueue() {
+        for (auto& chunk : chunks) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    LifetimeEventQueue(const LifetimeEventQueue&) = delete;
+    LifetimeEventQueue& operator=(const LifetimeEventQueue&) = delete;
+
+    /// Append an event, safe from any thread
+    /// @return false if the queue is full and the event was dropped
+    bool Push(const LifetimeEvent& event) {
+        uint32_t index = Allocate();
+        if (index == Nil) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            overflowed.store(true, std::memory_order_release);
+            return false;
+        }
+
+        EventNode& node = Node(index);
+        node.event = event;
+        node.next.store(Nil, std::memory_order_relaxed);
+
+        uint32_t previous = head.exchange(index, std::memory_order_acq_rel);
+        Node(previous).next.store(index, std::memory_order_release);
+        return true;
+    }
+
+    /// Check and clear whether events were dropped since the last call, consumer only
+    bool TakeOverflow() {
+        return overflowed.exchange(false, std::memory_order_acq_rel);
+    }
+
+    /// Total number of events dropped because the queue was full
+    uint64_t Dropped() const {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+    /// Consume every event published so far, in order
+    /// @param callback Invoked with each event
+    /// @return Number of events consumed
+    template<typename Callback>
+    size_t Drain(Callback&& callback) {
+        size_t count = 0;
+        for (;;) {
+            uint32_t next = Node(tail).next.load(std::memory_order_acquire);
+            if (next == Nil) break;
+
+            callback(Node(next).event);
+            Release(tail);
+            tail = next;
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    struct EventNode {
+        LifetimeEvent event;
+        std::atomic<uint32_t> next{Nil};   ///< Queue link, or free list link while the node is free
+    };
+
+    static constexpr uint32_t Nil = UINT32_MAX;
+    static constexpr uint32_t ChunkShift = 12;
+    static constexpr uint32_t ChunkSize = 1u << ChunkShift;
+    static constexpr uint32_t MaxChunks = 64;      ///< 256K events in flight before events are dropped
+
+    std::array<std::atomic<EventNode*>, MaxChunks> chunks{};
+    std::atomic<uint32_t> chunkCount{0};
+    std::atomic<uint64_t> freeList{Nil};            ///< ABA tag in the high 32 bits, node index in the low 32
+    std::atomic<uint32_t> head{Nil};                ///< Last pushed node, producers only
+    uint32_t tail{Nil};                             ///< Stub node before the oldest event, consumer only
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<bool> overflowed{false};
+
+    EventNode& Node(uint32_t index) {
+        return chunks[index >> ChunkShift].load(std::memory_order_acquire)[index & (ChunkSize - 1)];
+    }
+
+    static uint64_t Tagged(uint64_t tagged, uint32_t index) {
+        return (((tagged >> 32) + 1) << 32) | index;
+    }
+
+    /// Take a free node, growing if there's none
+    /// @return A node index, or Nil if every node is in flight and the chunk table is full
+    uint32_t Allocate() {
+        for (;;) {
+            uint64_t top = freeList.load(std::memory_order_acquire);
+            uint32_t index = static_cast<uint32_t>(top);
+            if (index == Nil) {
+                // Another producer may have freed or added nodes while the table filled up
+                index = Grow();
+                if (index != Nil || static_cast<uint32_t>(freeList.load(std::memory_order_acquire)) == Nil) {
+                    return index;
+                }
+                continue;
+            }
+
+            // A stale read here is harmless, the tag makes the exchange fail
+            uint32_t next = Node(index).next.load(std::memory_order_relaxed);
+            if (freeList.compare_exchange_weak(top, Tagged(top, next), std::memory_order_acq_rel)) {
+                return index;
+            }
+        }
+    }
+
+    void Release(uint32_t index) {
+        PushFree(index, index);
+    }
+
+    /// Push an already linked run of free nodes
+    void PushFree(uint32_t first, uint32_t last) {
+        uint64_t top = freeList.load(std::memory_order_relaxed);
+        do {
+            Node(last).next.store(static_cast<uint32_t>(top), std::memory_order_relaxed);
+        } while (!freeList.compare_exchange_weak(top, Tagged(top, first), std::memory_order_acq_rel));
+    }
+
+    /// Add a chunk of nodes, keeping the first one for the caller
+    /// @return A node index, or Nil if the chunk table is full
+    uint32_t Grow() {
+        uint32_t chunk = chunkCount.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= MaxChunks) {
+            chunkCount.fetch_sub(1, std::memory_order_relaxed);
+            return Nil;
+        }
+
+        auto* nodes = new EventNode[ChunkSize];
+        uint32_t base = chunk << ChunkShift;
+        for (uint32_t i = 1; i + 1 < ChunkSize; ++i) {
+            nodes[i].next.store(base + i + 1, std::memory_order_relaxed);
+        }
+        chunks[chunk].store(nodes, std::memory_order_release);
+
+        PushFree(base + 1, base + ChunkSize - 1);
+        return base;
+    }
+};
+
+/// Multi-pattern substring matcher compiled into a single Aho-Corasick automaton
+///
+/// All patterns are matched in one pass over the text regardless of how many are registered.
+/// Characters that appear in no pattern share one alphabet class, so the transition table
+/// stays small even for wide names.
+class NamePatternMatcher {
+public:
+    /// Compile a set of patterns, replacing the previous automaton
+    void Build(const std::vector<std::wstring>& patterns) {
+        asciiClass.fill(0);
+        wideClass.clear();
+        alphabetSize = 1;
+        for (const auto& pattern : patterns) {
+            for (wchar_t c : pattern) {
+                if (ClassOf(c) == 0) {
+                    if (static_cast<uint32_t>(c) < asciiClass.size()) {
+                        asciiClass[c] = alphabetSize++;
+                    } else {
+                        wideClass.emplace(c, alphabetSize++);
+                    }
+                }
+            }
+        }
+
+        // Trie, -1 marks a missing edge
+        transitions.assign(alphabetSize, -1);
+        accepting.assign(1, false);
+        for (const auto& pattern : patterns) {
+            if (pattern.empty()) continue;
+
+            int32_t state = 0;
+            for (wchar_t c : pattern) {
+                int32_t& next = transitions[state * alphabetSize + ClassOf(c)];
+                if (next == -1) {
+                    next = static_cast<int32_t>(accepting.size());
+                    accepting.push_back(false);
+                    transitions.resize(transitions.size() + alphabetSize, -1);
+                }
+                state = transitions[state * alphabetSize + ClassOf(c)];
+            }
+            accepting[state] = true;
+        }
+
+        // Breadth-first failure links, folded into a complete DFA
+        std::vector<int32_t> fail(accepting.size(), 0);
+        std::queue<int32_t> frontier;
+        for (uint16_t a = 0; a < alphabetSize; ++a) {
+            int32_t& next = transitions[a];
+            if (next == -1) {
+                next = 0;
+            } else {
+                frontier.push(next);
+            }
+        }
+        while (!frontier.empty()) {
+            int32_t state = frontier.front();
+            frontier.pop();
+            accepting[state] = accepting[state] || accepting[fail[state]];
+            for (uint16_t a = 0; a < alphabetSize; ++a) {
+                int32_t& next = transitions[state * alphabetSize + a];
+                int32_t fallback = transitions[fail[state] * alphabetSize + a];
+                if (next == -1) {
+                    next = fallback;
+                } else {
+                    fail[next] = fallback;
+                    frontier.push(next);
+                }
+            }
+        }
+        empty = accepting.size() == 1;
+    }
+
+    /// Check if any pattern occurs in the text
+    bool Matches(std::wstring_view text) const {
+        if (empty) return false;
+
+        int32_t state = 0;
+        for (wchar_t c : text) {
+            state = transitions[state * alphabetSize + ClassOf(c)];
+            if (accepting[state]) return true;
+        }
+        return false;
+    }
+
+private:
+    std::array<uint16_t, 128> asciiClass{};
+    std::unordered_map<wchar_t, uint16_t> wideClass;
+    uint16_t alphabetSize{1};
+    std::vector<int32_t> transitions;
+    std::vector<bool> accepting;
+    bool empty{true};
+
+    uint16_t ClassOf(wchar_t c) const {
+        if (static_cast<uint32_t>(c) < asciiClass.size()) return asciiClass[c];
+        auto it = wideClass.find(c);
+        return it != wideClass.end() ? it->second : 0;
+    }
+};
+
 /// ObjectLifetimeTracker provides RAII-style lifetime tracking for UObjects with additional state monitoring
 /// 
 /// By default tracks:
@@ -27,6 +305,27 @@ namespace RC::Unreal {
 /// - Registering specific UClass types
 /// - Registering name patterns to match against
 ///
+/// Tracking rules are evaluated once per new object during maintenance: name patterns are
+/// compiled into one automaton and results are memoized per FName comparison index, tracked
+/// types are checked with one ancestry bitmask per class. Liveness checks work for any object;
+/// the Find* queries only return tracked ones.
+///
+/// Objects are stored in a flat, chunked table addressed by their UObjectArray index.
+/// Each slot carries a serial number that changes whenever the index is reused, so an
+/// (index, serial) pair identifies one object instance the same way a weak pointer does.
+///
+/// The UObjectArray listeners publish liveness straight into the slot atomically, record the
+/// object's address in a sharded address map and push create/delete events onto a lock-free
+/// queue. The bookkeeping behind those events (names, flags, erasing destroyed entries) runs
+/// in a deferred maintenance step, so IsActorAlive() and IsAlive() never take the tracker
+/// lock and never write.
+///
+/// IsActorAlive() finds a raw pointer's index through the address map and only reads the
+/// object's flags once the slot confirms it is registered, so it's safe with a pointer that
+/// was already freed. Objects created before the listeners were installed are only in the
+/// map once they were tracked or watched. Keeping an (index, serial) pair (or a TrackedPtr)
+/// and calling IsAlive() skips the map lookup.
+///
 /// The tracker maintains detailed object state including:
 /// - Validity status
 /// - Object name
@@ -58,6 +357,34 @@ public:
         RC::Unreal::EObjectFlags flags{}; ///< Current object flags
     };
 
+    /// A class followed by its super classes, captured while the class was loaded
+    using ClassChain = std::shared_ptr<const std::vector<const RC::Unreal::UClass*>>;
+
+    /// Lifetime change of a tracked object, delivered to subscribers
+    struct Notification {
+        enum class Type : uint8_t {
+            Created      = 1 << 0,     ///< Started being tracked, the object is usable
+            BeginDestroy = 1 << 1,     ///< RF_BeginDestroyed was set, stop using the object
+            Deleted      = 1 << 2,     ///< Removed from UObjectArray, the pointer is dangling
+        };
+
+        Type type;
+        const RC::Unreal::UObjectBase* object;  ///< Only safe to dereference for Created
+        const RC::Unreal::UClass* objectClass;  ///< Only safe to dereference for Created
+        ObjectInfo info;
+        ClassChain ancestry;                    ///< objectClass and its super classes, compared by address
+    };
+
+    using NotificationCallback = std::function<void(const Notification&)>;
+    using SubscriptionId = uint64_t;
+
+    /// Called with the address and serial of a deleted watched object, see WatchObject()
+    /// A null object means events were lost and any watched object may be gone
+    using DeleteWatcher = std::function<void(const RC::Unreal::UObjectBase* object, uint32_t serial)>;
+
+    /// Event mask for Subscribe()
+    static constexpr uint8_t AllNotifications = 0x7;
+
     /// Get the singleton instance of ObjectLifetimeTracker
     static ObjectLifetimeTracker& Get() {
         static ObjectLifetimeTracker instance;
@@ -66,35 +393,195 @@ public:
 
 
     /// Check if a UObject pointer is still valid and not pending destruction
+    /// Safe from any thread and with a freed pointer: the index is looked up by address under
+    /// a shared shard lock, the object is only read once its slot confirms it. Never writes.
     /// @param actor The UObject to check
-    /// @return true if the object is being tracked, valid, and not marked for destruction
-    bool IsActorAlive(const RC::Unreal::UObjectBase* actor) {
+    /// @return true if the listeners saw the object created, it wasn't deleted since and isn't
+    ///         marked for destruction
+    bool IsActorAlive(const RC::Unreal::UObjectBase* actor) const {
         if (!actor) return false;
-    
-        std::lock_guard lock(objectsLock);
-        auto it = liveObjects.find(actor);
-        if (it == liveObjects.end()) return false;
+        return IsAlive(IndexOf(actor), actor);
+    }
 
-        // Update info if it's still "pending"
-        if (it->second.name == L"pending") {
-            try {
-                auto uobject = std::bit_cast<RC::Unreal::UObject*>(actor);
-                if (uobject) {
-                    it->second.name = uobject->GetName();
-                    it->second.flags = uobject->GetObjectFlags();
+    /// Check an object against GUObjectArray, also one the listeners never saw
+    /// Doesn't start tracking the object. Reads the object's index through the pointer, so it
+    /// must not have been freed, e.g. one obtained on the game thread this frame.
+    /// @return true if GUObjectArray holds the object at its index and it isn't being destroyed
+    bool IsValidUObject(const RC::Unreal::UObjectBase* object) const {
+        if (!object) return false;
+        return IsRegistered(object, object->GetInternalIndex()) && !IsBeingDestroyed(object);
+    }
+
+    /// Check if the object that held an index when its serial was taken is still alive
+    /// Lock-free, safe to call from any thread, also after the object was freed
+    /// @param index The object's UObjectArray index
+    /// @param serial The slot serial returned by GetSerialNumber()
+    /// @return true if the slot still holds the same, valid object
+    bool IsAlive(RC::Unreal::int32 index, uint32_t serial) const {
+        const Slot* slot = SlotAt(index);
+        if (!slot || slot->serial.load(std::memory_order_acquire) != serial) return false;
+
+        const RC::Unreal::UObjectBase* object = slot->object.load(std::memory_order_acquire);
+
+        // Any create or delete in between bumps the serial
+        if (!object || slot->serial.load(std::memory_order_acquire) != serial) return false;
+
+        // The object can only be freed after its delete listener bumped the serial, so check
+        // again that the flags were read from the same, still registered object
+        const bool destroying = IsBeingDestroyed(object);
+        return !destroying && slot->serial.load(std::memory_order_acquire) == serial;
+    }
+
+    /// Get the serial number of the slot currently holding an object
+    /// Together with object->GetInternalIndex() this is the handle IsAlive() takes
+    /// @param object The object, looked up by address so it may have been freed
+    /// @return The slot serial, or 0 if the listeners didn't see the object or it was deleted
+    uint32_t GetSerialNumber(const RC::Unreal::UObjectBase* object) const {
+        if (!object) return 0;
+
+        const Slot* slot = SlotAt(IndexOf(object));
+        if (!slot) return 0;
+
+        uint32_t serial = slot->serial.load(std::memory_order_acquire);
+        return slot->object.load(std::memory_order_acquire) == object ? serial : 0;
+    }
+
+    /// Check that an object still occupies the slot it had when its serial was taken
+    /// Lock-free and cheaper than IsAlive(), it doesn't read the object's flags. Serials are
+    /// never reused, so a different object at the same address or index doesn't match.
+    /// @param object An object known to be allocated, e.g. the class of a live object
+    /// @param serial The serial returned by WatchObject() or GetSerialNumber()
+    bool IsCurrent(const RC::Unreal::UObjectBase* object, uint32_t serial) const {
+        if (!object || serial == 0) return false;
+
+        const Slot* slot = SlotAt(object->GetInternalIndex());
+        return slot && slot->serial.load(std::memory_order_acquire) == serial &&
+               slot->object.load(std::memory_order_acquire) == object;
+    }
+
+    /// Get told when an object is deleted, without tracking it
+    /// Meant for caches keyed by engine objects such as classes and functions: the object
+    /// isn't added to the Find* indexes and produces no notifications for subscribers. Its
+    /// deletion is reported once to every delete watcher, from ProcessPendingEvents().
+    /// Lock-free unless the object predates the listeners; safe inside ForEach* callbacks.
+    /// @param object An object known to be allocated and registered in GUObjectArray
+    /// @return The object's serial for IsCurrent(), or 0 if GUObjectArray doesn't hold it
+    uint32_t WatchObject(const RC::Unreal::UObjectBase* object) {
+        if (!object) return 0;
+
+        Slot* slot = FindSlot(object);
+        if (!slot) {
+            slot = PublishExisting(object);
+            if (!slot) return 0;
+        }
+
+        slot->watched.store(object, std::memory_order_release);
+        const uint32_t serial = slot->serial.load(std::memory_order_acquire);
+        return slot->object.load(std::memory_order_acquire) == object ? serial : 0;
+    }
+
+    /// Number of watched objects deleted so far, bumped as soon as the delete listener runs
+    uint64_t WatchGeneration() const {
+        return watchGeneration.load(std::memory_order_acquire);
+    }
+
+    /// Register a callback for deletions of objects passed to WatchObject()
+    /// Called from ProcessPendingEvents() without the tracker lock held
+    /// @return Id to pass to RemoveDeleteWatcher()
+    SubscriptionId AddDeleteWatcher(DeleteWatcher callback) {
+        auto watcher = std::make_shared<std::pair<SubscriptionId, DeleteWatcher>>(0, std::move(callback));
+
+        std::lock_guard lock(subscribersLock);
+        watcher->first = ++lastSubscriptionId;
+        deleteWatchers.push_back(std::move(watcher));
+        return lastSubscriptionId;
+    }
+
+    /// Remove a delete watcher
+    /// @param id The id returned by AddDeleteWatcher()
+    /// @return true if the watcher existed
+    bool RemoveDeleteWatcher(SubscriptionId id) {
+        std::lock_guard lock(subscribersLock);
+        return std::erase_if(deleteWatchers, [id](const auto& watcher) { return watcher->first == id; }) > 0;
+    }
+
+    /// Number of lifetime events dropped because maintenance fell too far behind
+    /// The tracker resynchronizes after a drop, but notifications for objects created and
+    /// deleted in between are lost
+    uint64_t DroppedEvents() const {
+        return events.Dropped();
+    }
+
+    /// Run the deferred maintenance step
+    /// Applies queued create/delete events, fills in names of new objects and erases entries
+    /// that began destruction. Queries run it themselves; calling it once per frame from the
+    /// game thread keeps that work off them.
+    void ProcessPendingEvents() {
+        std::vector<Notification> batch;
+        std::vector<std::pair<const RC::Unreal::UObjectBase*, uint32_t>> deletions;
+        {
+            std::lock_guard lock(objectsLock);
+            RunMaintenance();
+
+            // Destruction starts without any UObjectArray event, so tracked objects are
+            // checked here, and only while someone is listening for it
+            if (destroyWatchers.load(std::memory_order_relaxed) > 0) {
+                for (auto& [bucketClass, members] : classBuckets) {
+                    for (Slot* slot : members) CheckLive(*slot);
                 }
-            } catch (...) {
-                // If we can't update, just return what we know
             }
+            batch.swap(notifications);
+            deletions.swap(watchedDeletions);
         }
+        DeliverNotifications(batch);
+        DeliverDeletions(deletions);
+    }
 
-        // Check for destruction flags
-        if (it->second.flags & RC::Unreal::EObjectFlags::RF_BeginDestroyed) {
-            liveObjects.erase(it);
-            return false;
+    /// Subscribe to lifetime changes of tracked objects
+    /// Notifications are batched and delivered from ProcessPendingEvents(), never from the
+    /// UObjectArray listener, so callbacks may call any tracker method
+    /// @param filterClass Only objects of this class or its child classes, or nullptr for any
+    /// @param namePattern Only objects whose name contains this string, or empty for any
+    /// @param callback Called once per matching notification
+    /// @param typeMask Bitwise OR of Notification::Type values to receive
+    /// @return Id to pass to Unsubscribe()
+    /// @note Only tracked objects generate notifications; register the type or name as well
+    SubscriptionId Subscribe(
+        RC::Unreal::UClass* filterClass,
+        std::wstring namePattern,
+        NotificationCallback callback,
+        uint8_t typeMask = AllNotifications
+    ) {
+        auto subscription = std::make_shared<Subscription>();
+        subscription->filterClass = filterClass;
+        subscription->namePattern = std::move(namePattern);
+        subscription->callback = std::move(callback);
+        subscription->typeMask = typeMask;
+
+        std::lock_guard lock(subscribersLock);
+        subscription->id = ++lastSubscriptionId;
+        subscribers.push_back(std::move(subscription));
+        if (typeMask & static_cast<uint8_t>(Notification::Type::BeginDestroy)) {
+            destroyWatchers.fetch_add(1, std::memory_order_relaxed);
         }
+        return lastSubscriptionId;
+    }
+
+    /// Remove a subscription
+    /// @param id The id returned by Subscribe()
+    /// @return true if the subscription existed
+    bool Unsubscribe(SubscriptionId id) {
+        std::lock_guard lock(subscribersLock);
+        auto it = std::find_if(subscribers.begin(), subscribers.end(), [id](const auto& subscription) {
+            return subscription->id == id;
+        });
+        if (it == subscribers.end()) return false;
 
-        return it->second.isValid;
+        if ((*it)->typeMask & static_cast<uint8_t>(Notification::Type::BeginDestroy)) {
+            destroyWatchers.fetch_sub(1, std::memory_order_relaxed);
+        }
+        subscribers.erase(it);
+        return true;
     }
 
     /// Register a UClass to be tracked by the lifetime system
@@ -107,6 +594,7 @@ public:
         }
         std::lock_guard lock(objectsLock);
         trackedTypes.insert(classToTrack);
+        rulesDirty = true;
         RC::Output::send<RC::LogLevel::Verbose>(STR("Registered tracked type: {}\n"), 
             classToTrack->GetName().c_str());
     }
@@ -121,6 +609,7 @@ public:
         }
         std::lock_guard lock(objectsLock);
         trackedNames.insert(nameToTrack);
+        rulesDirty = true;
         RC::Output::send<RC::LogLevel::Verbose>(STR("Registered tracked name pattern: {}\n"), 
             nameToTrack.c_str());
     }
@@ -131,6 +620,7 @@ public:
     void UnregisterTrackedType(RC::Unreal::UClass* classToTrack) {
         std::lock_guard lock(objectsLock);
         trackedTypes.erase(classToTrack);
+        rulesDirty = true;
     }
 
     /// Remove a name pattern from the tracking system
@@ -139,109 +629,237 @@ public:
     void UnregisterTrackedName(const std::wstring& nameToTrack) {
         std::lock_guard lock(objectsLock);
         trackedNames.erase(nameToTrack);
+        rulesDirty = true;
     }
 
     /// Clear all tracking data and patterns
     /// Removes all tracked objects, types, and name patterns
     void ClearAllTracking() {
         std::lock_guard lock(objectsLock);
-        liveObjects.clear();
+        RunMaintenance();
+        ForEachSlot([this](Slot& slot, RC::Unreal::int32 index) { ReleaseSlot(slot, index); });
+        pendingNames.clear();
+        notifications.clear();
+        classBuckets.clear();
+        nameBuckets.clear();
         trackedTypes.clear();
         trackedNames.clear();
+        rulesDirty = true;
         RC::Output::send<RC::LogLevel::Verbose>(STR("Cleared all object tracking\n"));
     }
 
     /// Explicitly track a specific UObject instance
+    /// Call from the game thread with an object known to be alive
     /// @param object The UObject pointer to track
-    /// @return true if the object was successfully added to tracking
+    /// @return true if the object was successfully added to tracking, false if it isn't the
+    ///         object GUObjectArray holds at its index
     bool TrackSpecificObject(const RC::Unreal::UObjectBase* object) {
         if (!object) {
             return false;
         }
 
         std::lock_guard lock(objectsLock);
+        RunMaintenance();
     
-        // Check if already tracking
-        if (liveObjects.contains(object)) {
+        // Every object the listeners saw has a slot, but only matching ones are tracked
+        Slot* slot = FindSlot(object);
+        if (slot && slot->tracked) {
             return true;
         }
 
-        ObjectInfo info;
-        info.isValid = true;
-        info.name = L"unknown";
-        info.address = reinterpret_cast<uintptr_t>(object);
-        info.flags = {}; 
+        if (!slot) {
+            slot = PublishExisting(object);
+            if (!slot) {
+                return false;
+            }
+        }
 
-        liveObjects[object] = info;
+        if (slot->info.address != reinterpret_cast<uintptr_t>(object)) {
+            InitInfo(*slot, object, L"unknown");
+        }
+        try {
+            IndexSlot(*slot, std::bit_cast<RC::Unreal::UObject*>(object));
+        } catch (...) {
+            // Still tracked for liveness, just not findable
+        }
         return true;
     }
 
     
-    /// Find all tracked objects of a specific UClass type
+    /// Visit every tracked object of a UClass type or its child classes
+    /// Walks the per-class buckets, so the cost follows the number of matches, not the world size
     /// @param classToFind The UClass to search for
-    /// @return Vector of pairs containing the object pointer and its info
-    std::vector<std::pair<const RC::Unreal::UObjectBase*, ObjectInfo>> FindObjectsByClass(RC::Unreal::UClass* classToFind) {
+    /// @param callback Called with (const UObjectBase*, const ObjectInfo&) for each match
+    /// @note Runs under the tracker lock; the callback may use IsActorAlive but no other tracker method
+    template<typename Callback>
+    void ForEachObjectOfClass(RC::Unreal::UClass* classToFind, Callback&& callback) {
         if (!classToFind) {
             RC::Output::send<RC::LogLevel::Warning>(STR("Attempted to search with null class type\n"));
-            return {};
+            return;
         }
 
-        std::vector<std::pair<const RC::Unreal::UObjectBase*, ObjectInfo>> results;
         std::lock_guard lock(objectsLock);
+        RunMaintenance();
 
-        for (const auto& [obj, info] : liveObjects) {
-            auto uobject = std::bit_cast<RC::Unreal::UObject*>(obj);
-            if (uobject && uobject->IsA(classToFind)) {
-                results.emplace_back(obj, info);
+        for (const auto& [bucketClass, members] : classBuckets) {
+            if (!IsChildOf(bucketClass, classToFind)) continue;
+            for (Slot* slot : members) {
+                if (CheckLive(*slot)) {
+                    callback(slot->object.load(std::memory_order_acquire), std::as_const(slot->info));
+                }
             }
         }
-
-        return results;
     }
 
-    /// Find all tracked objects whose names contain the specified string
+    /// Visit every tracked object whose name contains the specified string
+    /// Patterns are tested once per distinct interned name, against names folded when interned
     /// @param namePattern The string to search for in object names
     /// @param caseSensitive Whether to perform case-sensitive matching
-    /// @return Vector of pairs containing the object pointer and its info
-    std::vector<std::pair<const RC::Unreal::UObjectBase*, ObjectInfo>> FindObjectsByName(
-        const std::wstring& namePattern, 
-        bool caseSensitive = true
-    ) {
+    /// @param callback Called with (const UObjectBase*, const ObjectInfo&) for each match
+    /// @note Runs under the tracker lock; the callback may use IsActorAlive but no other tracker method
+    template<typename Callback>
+    void ForEachObjectByName(const std::wstring& namePattern, bool caseSensitive, Callback&& callback) {
         if (namePattern.empty()) {
             RC::Output::send<RC::LogLevel::Warning>(STR("Attempted to search with empty name pattern\n"));
-            return {};
+            return;
         }
 
-        std::vector<std::pair<const RC::Unreal::UObjectBase*, ObjectInfo>> results;
+        const std::wstring pattern = caseSensitive ? namePattern : FoldCase(namePattern);
+
+        // Only a pattern with '_' or digits can match across the "_N" suffix of a numbered name
+        const bool canSpanSuffix = pattern.find_first_of(L"_0123456789") != std::wstring::npos;
+
         std::lock_guard lock(objectsLock);
+        RunMaintenance();
 
-        for (const auto& [obj, info] : liveObjects) {
-            bool matches;
-            if (caseSensitive) {
-                matches = info.name.find(namePattern) != std::wstring::npos;
-            } else {
-                // Convert both strings to lowercase for case-insensitive comparison
-                std::wstring lowerName = info.name;
-                std::wstring lowerPattern = namePattern;
-                std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::towlower);
-                std::transform(lowerPattern.begin(), lowerPattern.end(), lowerPattern.begin(), ::towlower);
-                matches = lowerName.find(lowerPattern) != std::wstring::npos;
-            }
+        for (const auto& [comparisonIndex, entry] : nameBuckets) {
+            const std::wstring& baseName = caseSensitive ? entry.base : entry.folded;
+            const bool baseMatches = baseName.find(pattern) != std::wstring::npos;
+            if (!baseMatches && !canSpanSuffix) continue;
 
-            if (matches) {
-                results.emplace_back(obj, info);
+            for (Slot* slot : entry.members) {
+                if (!baseMatches) {
+                    const std::wstring fullName = caseSensitive ? slot->info.name : FoldCase(slot->info.name);
+                    if (fullName.find(pattern) == std::wstring::npos) continue;
+                }
+                if (CheckLive(*slot)) {
+                    callback(slot->object.load(std::memory_order_acquire), std::as_const(slot->info));
+                }
             }
         }
+    }
 
+    /// Find all tracked objects of a specific UClass type
+    /// @param classToFind The UClass to search for
+    /// @return Vector of pairs containing the object pointer and its info
+    std::vector<std::pair<const RC::Unreal::UObjectBase*, ObjectInfo>> FindObjectsByClass(RC::Unreal::UClass* classToFind) {
+        std::vector<std::pair<const RC::Unreal::UObjectBase*, ObjectInfo>> results;
+        ForEachObjectOfClass(classToFind, [&](const RC::Unreal::UObjectBase* object, const ObjectInfo& info) {
+            results.emplace_back(object, info);
+        });
+        return results;
+    }
+
+    /// Find all tracked objects whose names contain the specified string
+    /// @param namePattern The string to search for in object names
+    /// @param caseSensitive Whether to perform case-sensitive matching
+    /// @return Vector of pairs containing the object pointer and its info
+    std::vector<std::pair<const RC::Unreal::UObjectBase*, ObjectInfo>> FindObjectsByName(
+        const std::wstring& namePattern, 
+        bool caseSensitive = true
+    ) {
+        std::vector<std::pair<const RC::Unreal::UObjectBase*, ObjectInfo>> results;
+        ForEachObjectByName(namePattern, caseSensitive, [&](const RC::Unreal::UObjectBase* object, const ObjectInfo& info) {
+            results.emplace_back(object, info);
+        });
         return results;
     }
 
 private:
-    std::unordered_map<const RC::Unreal::UObjectBase*, ObjectInfo> liveObjects;
+    /// One entry of the object table, addressed by UObjectArray index
+    /// object and serial are written by the listeners and read lock-free;
+    /// info is only touched under objectsLock
+    struct Slot {
+        std::atomic<const RC::Unreal::UObjectBase*> object{nullptr};  ///< Object occupying the index, null if free
+        std::atomic<uint32_t> serial{0};    ///< New on every create, bumped on delete, odd while occupied
+        std::atomic<const RC::Unreal::UObjectBase*> watched{nullptr};  ///< Set by WatchObject() until deleted
+        ObjectInfo info;
+        bool tracked{false};                ///< Matched the tracking rules, only these are returned by Find*
+
+        // Position in the query indexes while tracked
+        const RC::Unreal::UClass* bucketClass{nullptr};
+        ClassChain ancestry;                ///< Class chain of bucketClass, for subscriber filters
+        uint32_t classPos{0};
+        uint32_t nameKey{0};
+        uint32_t namePos{0};
+    };
+
+    struct Subscription {
+        SubscriptionId id{0};
+        const RC::Unreal::UClass* filterClass{nullptr};
+        std::wstring namePattern;
+        NotificationCallback callback;
+        uint8_t typeMask{AllNotifications};
+    };
+
+    /// Interned name shared by every tracked object with the same FName comparison index
+    struct NameBucket {
+        std::wstring base;                  ///< Name without the "_N" number suffix
+        std::wstring folded;                ///< Lowercase base, for case-insensitive queries
+        std::vector<Slot*> members;
+    };
+
+    /// Part of the address map, sharded so listeners on different threads rarely contend
+    struct AddressShard {
+        mutable std::shared_mutex lock;
+        std::unordered_map<const RC::Unreal::UObjectBase*, RC::Unreal::int32> indexes;
+    };
+
+    static constexpr size_t AddressShards = 64;
+
+    static constexpr RC::Unreal::int32 SlotsPerChunk = 64 * 1024;
+    static constexpr RC::Unreal::int32 MaxChunks = 128;    ///< 8M objects, well above GUObjectArray's default cap
+
+    std::array<std::atomic<Slot*>, MaxChunks> chunks{};
+    std::array<AddressShard, AddressShards> addresses;  ///< Published objects by address
+    LifetimeEventQueue events;
+    std::vector<RC::Unreal::int32> pendingNames;    ///< Slots created since the last maintenance step
     std::unordered_set<RC::Unreal::UClass*> trackedTypes;
     std::unordered_set<std::wstring> trackedNames;
     std::mutex objectsLock;
 
+    /// Ancestry bit of the last tracked type, bit 0 is AGameModeBase and every type gets the next bit;
+    /// past 63 types they share this one, which is enough since masks are only tested for nonzero
+    static constexpr uint64_t LastTypeBit = 1ull << 63;
+
+    // Compiled tracking rules, rebuilt during maintenance when rulesDirty is set
+    bool rulesDirty{true};
+    NamePatternMatcher nameMatcher;
+    std::unordered_map<const RC::Unreal::UStruct*, uint64_t> typeBits;       ///< Bit per tracked type
+    std::unordered_map<const RC::Unreal::UClass*, uint64_t> ancestryMasks;   ///< Memo: tracked types a class derives from
+    std::unordered_map<const RC::Unreal::UClass*, ClassChain> classChains;   ///< Memo: super class chain of a loaded class
+    std::unordered_map<uint32_t, bool> nameMatches;                          ///< Memo: FName comparison index -> base name match
+    bool patternsSpanSuffix{false};                                          ///< A pattern has '_' or a digit
+
+    // Query indexes over tracked objects, slots never move so they are stored by address
+    std::unordered_map<const RC::Unreal::UClass*, std::vector<Slot*>> classBuckets;
+    std::unordered_map<uint32_t, NameBucket> nameBuckets;
+
+    // Subscriptions, held by shared_ptr so delivery can run on a snapshot without the lock
+    std::vector<Notification> notifications;                                 ///< Batched until ProcessPendingEvents
+    std::vector<std::shared_ptr<Subscription>> subscribers;
+    SubscriptionId lastSubscriptionId{0};
+    std::atomic<int> destroyWatchers{0};
+    std::vector<std::shared_ptr<std::pair<SubscriptionId, DeleteWatcher>>> deleteWatchers;
+    std::mutex subscribersLock;
+
+    // Watched objects, see WatchObject()
+    std::vector<std::pair<const RC::Unreal::UObjectBase*, uint32_t>> watchedDeletions;  ///< Batched until ProcessPendingEvents
+    std::atomic<uint64_t> watchGeneration{0};
+    std::mutex publishLock;                         ///< Serializes publishing objects that predate the listeners
+
+    static inline std::atomic<uint32_t> nextSerial{1};  ///< Odd serials handed out by PublishCreated
+
     /// Constructor sets up object creation and deletion listeners
     ObjectLifetimeTracker() {
         RC::Unreal::UObjectArray::AddUObjectCreateListener(&createListener);
@@ -252,44 +870,522 @@ private:
     ~ObjectLifetimeTracker() {
         RC::Unreal::UObjectArray::RemoveUObjectCreateListener(&createListener);
         RC::Unreal::UObjectArray::RemoveUObjectDeleteListener(&deleteListener);
+        for (auto& chunk : chunks) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
     }
 
-    /// Determines if an object should be tracked based on type and name rules
-    /// @param uobject The object to evaluate
-    /// @return true if the object matches tracking criteria
-    bool ShouldTrackObject(RC::Unreal::UObject* uobject) {
-        if (!uobject) return false;
+    /// Check that GUObjectArray holds an object at an index
+    static bool IsRegistered(const RC::Unreal::UObjectBase* object, RC::Unreal::int32 index) {
+        if (index < 0) return false;
+        const RC::Unreal::FUObjectItem* item = RC::Unreal::UObjectArray::IndexToObject(index);
+        return item && item->GetUObject() == object;
+    }
 
-        // Check if it's a GameMode
-        if (uobject->IsA(RC::Unreal::AGameModeBase::StaticClass())) {
-            return true;
+    static bool IsBeingDestroyed(const RC::Unreal::UObjectBase* object) {
+        auto uobject = std::bit_cast<const RC::Unreal::UObject*>(object);
+        return uobject->GetObjectFlags() & RC::Unreal::EObjectFlags::RF_BeginDestroyed;
+    }
+
+    AddressShard& ShardOf(const RC::Unreal::UObjectBase* object) const {
+        // UObjects are at least 16-byte aligned, the low bits carry no information
+        const auto key = reinterpret_cast<uintptr_t>(object) >> 4;
+        return const_cast<AddressShard&>(addresses[(key ^ (key >> 6)) % AddressShards]);
+    }
+
+    /// Look up the index of a published object by address, without dereferencing it
+    /// @return The index, or INDEX_NONE if no published object has that address
+    RC::Unreal::int32 IndexOf(const RC::Unreal::UObjectBase* object) const {
+        AddressShard& shard = ShardOf(object);
+        std::shared_lock lock(shard.lock);
+        auto it = shard.indexes.find(object);
+        return it != shard.indexes.end() ? it->second : INDEX_NONE;
+    }
+
+    /// Check the object at an index against the serial its slot holds now
+    /// The object is only read while the slot holds it, with the serial re-checked after
+    bool IsAlive(RC::Unreal::int32 index, const RC::Unreal::UObjectBase* object) const {
+        const Slot* slot = SlotAt(index);
+        if (!slot) return false;
+
+        const uint32_t serial = slot->serial.load(std::memory_order_acquire);
+        if (slot->object.load(std::memory_order_acquire) != object) return false;
+
+        const bool destroying = IsBeingDestroyed(object);
+        return !destroying && slot->serial.load(std::memory_order_acquire) == serial;
+    }
+
+    /// Get the slot for an index without allocating
+    /// @return The slot, or nullptr if the index is out of range or its chunk doesn't exist yet
+    Slot* SlotAt(RC::Unreal::int32 index) const {
+        if (index < 0 || index >= SlotsPerChunk * MaxChunks) return nullptr;
+        Slot* chunk = chunks[index / SlotsPerChunk].load(std::memory_order_acquire);
+        return chunk ? &chunk[index % SlotsPerChunk] : nullptr;
+    }
+
+    /// Get the slot currently holding an object
+    /// @return The slot, or nullptr if the object isn't tracked
+    Slot* FindSlot(const RC::Unreal::UObjectBase* object) const {
+        Slot* slot = SlotAt(object->GetInternalIndex());
+        return slot && slot->object.load(std::memory_order_acquire) == object ? slot : nullptr;
+    }
+
+    /// Get the slot for an index, allocating its chunk on first use without locking
+    /// @return The slot, or nullptr if the index is out of range
+    Slot* EnsureSlot(RC::Unreal::int32 index) {
+        if (index < 0 || index >= SlotsPerChunk * MaxChunks) return nullptr;
+        auto& chunk = chunks[index / SlotsPerChunk];
+        Slot* slots = chunk.load(std::memory_order_acquire);
+        if (!slots) {
+            auto* fresh = new Slot[SlotsPerChunk];
+            if (chunk.compare_exchange_strong(slots, fresh, std::memory_order_acq_rel)) {
+                slots = fresh;
+            } else {
+                delete[] fresh;     // Another thread installed the chunk first
+            }
         }
+        return &slots[index % SlotsPerChunk];
+    }
 
-        // Check custom tracked types
-        for (auto trackedType : trackedTypes) {
-            if (uobject->IsA(trackedType)) {
-                return true;
+    /// Make an object visible to lock-free readers, called from the create listener
+    /// Every object gets a serial no slot had before, so serials identify objects on their own
+    Slot* PublishCreated(const RC::Unreal::UObjectBase* object, RC::Unreal::int32 index) {
+        Slot* slot = EnsureSlot(index);
+        if (!slot) return nullptr;
+
+        {
+            AddressShard& shard = ShardOf(object);
+            std::unique_lock lock(shard.lock);
+            shard.indexes.insert_or_assign(object, index);
+        }
+        slot->serial.store(nextSerial.fetch_add(2, std::memory_order_relaxed), std::memory_order_release);
+        slot->object.store(object, std::memory_order_release);
+        return slot;
+    }
+
+    /// Publish an object created before the listeners were installed, which never produced an event
+    /// @return The object's slot, or nullptr if GUObjectArray doesn't hold it at its index
+    Slot* PublishExisting(const RC::Unreal::UObjectBase* object) {
+        std::lock_guard lock(publishLock);
+        if (Slot* slot = FindSlot(object)) return slot;
+
+        // Never publish an unverified pointer, a stale one would be reported alive
+        const RC::Unreal::int32 index = object->GetInternalIndex();
+        if (!IsRegistered(object, index)) return nullptr;
+
+        return PublishCreated(object, index);
+    }
+
+    /// Hide an object from lock-free readers, called from the delete listener
+    /// Leaves the slot alone if it already holds a different object
+    /// @return The serial the object had, or 0 if the slot didn't hold it
+    uint32_t PublishDeleted(Slot& slot, RC::Unreal::int32 index, const RC::Unreal::UObjectBase* object) {
+        if (!object) return 0;
+
+        {
+            AddressShard& shard = ShardOf(object);
+            std::unique_lock lock(shard.lock);
+            auto it = shard.indexes.find(object);
+            if (it != shard.indexes.end() && it->second == index) {
+                shard.indexes.erase(it);
             }
         }
 
-        // Check name patterns
-        std::wstring objName = uobject->GetName();
-        
-        // Always track mainPlayer
-        if (objName.find(L"mainPlayer") != std::wstring::npos) {
-            return true;
+        const RC::Unreal::UObjectBase* expected = object;
+        if (slot.object.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel)) {
+            return slot.serial.fetch_add(1, std::memory_order_acq_rel);
+        }
+        return 0;
+    }
+
+    /// Reset a slot's bookkeeping for a newly seen object, objectsLock must be held
+    void InitInfo(Slot& slot, const RC::Unreal::UObjectBase* object, const wchar_t* name) {
+        UnindexSlot(slot);
+        slot.info = ObjectInfo{};
+        slot.info.isValid = true;
+        slot.info.name = name;
+        slot.tracked = false;
+        slot.info.address = reinterpret_cast<uintptr_t>(object);
+    }
+
+    /// Stop tracking the object in a slot, objectsLock must be held
+    void ReleaseSlot(Slot& slot, RC::Unreal::int32 index) {
+        PublishDeleted(slot, index, slot.object.load(std::memory_order_acquire));
+        UnindexSlot(slot);
+        slot.info = ObjectInfo{};
+    }
+
+    /// Add a slot to the class and name indexes and mark it tracked
+    void IndexSlot(Slot& slot, RC::Unreal::UObject* uobject) {
+        if (slot.tracked) return;
+
+        slot.tracked = true;
+        slot.bucketClass = uobject->GetClassPrivate();
+        slot.ancestry = ChainOf(slot.bucketClass);
+        auto& members = classBuckets[slot.bucketClass];
+        slot.classPos = static_cast<uint32_t>(members.size());
+        members.push_back(&slot);
+
+        const RC::Unreal::FName name = uobject->GetNamePrivate();
+        slot.nameKey = name.GetComparisonIndex();
+        auto [it, inserted] = nameBuckets.try_emplace(slot.nameKey);
+        if (inserted) {
+            it->second.base = BaseName(name);
+            it->second.folded = FoldCase(it->second.base);
+        }
+        slot.namePos = static_cast<uint32_t>(it->second.members.size());
+        it->second.members.push_back(&slot);
+
+        Notify(Notification::Type::Created, slot, slot.object.load(std::memory_order_acquire));
+    }
+
+    /// Remove a slot from the query indexes and mark it untracked
+    void UnindexSlot(Slot& slot) {
+        if (!slot.tracked) return;
+        slot.tracked = false;
+        slot.ancestry.reset();
+
+        auto classIt = classBuckets.find(slot.bucketClass);
+        if (classIt != classBuckets.end()) {
+            SwapRemove(classIt->second, slot.classPos, &Slot::classPos);
+            if (classIt->second.empty()) classBuckets.erase(classIt);
+        }
+
+        auto nameIt = nameBuckets.find(slot.nameKey);
+        if (nameIt != nameBuckets.end()) {
+            SwapRemove(nameIt->second.members, slot.namePos, &Slot::namePos);
+            if (nameIt->second.members.empty()) nameBuckets.erase(nameIt);
         }
+    }
+
+    static void SwapRemove(std::vector<Slot*>& members, uint32_t pos, uint32_t Slot::* position) {
+        members[pos] = members.back();
+        members[pos]->*position = pos;
+        members.pop_back();
+    }
+
+    /// Check a tracked slot during a query, marking it invalid if its object began destruction
+    bool CheckLive(Slot& slot) {
+        const RC::Unreal::UObjectBase* object = slot.object.load(std::memory_order_acquire);
+        if (!object || !slot.info.isValid) return false;
 
-        // Check custom name patterns
-        for (const auto& trackedName : trackedNames) {
-            if (objName.find(trackedName) != std::wstring::npos) {
-                return true;
+        if (IsBeingDestroyed(object)) {
+            MarkDestroying(slot, object);
+            return false;
+        }
+        return true;
+    }
+
+    /// Record that a slot's object began destruction
+    void MarkDestroying(Slot& slot, const RC::Unreal::UObjectBase* object) {
+        slot.info.flags = std::bit_cast<const RC::Unreal::UObject*>(object)->GetObjectFlags();
+        slot.info.isValid = false;
+        if (slot.tracked) {
+            Notify(Notification::Type::BeginDestroy, slot, object);
+        }
+    }
+
+    /// Queue a notification for a tracked slot if anyone is subscribed
+    /// @param object The object the notification is about, not necessarily the slot's current one
+    void Notify(Notification::Type type, const Slot& slot, const RC::Unreal::UObjectBase* object) {
+        {
+            std::lock_guard lock(subscribersLock);
+            if (subscribers.empty()) return;
+        }
+        notifications.push_back(Notification{type, object, slot.bucketClass, slot.info, slot.ancestry});
+    }
+
+    /// Super class chain of a loaded class, memoized until the class is deleted
+    ClassChain ChainOf(const RC::Unreal::UClass* objectClass) {
+        auto [it, inserted] = classChains.try_emplace(objectClass);
+        if (inserted) {
+            auto chain = std::make_shared<std::vector<const RC::Unreal::UClass*>>();
+            for (const RC::Unreal::UStruct* current = objectClass; current; current = current->GetSuperStruct()) {
+                chain->push_back(static_cast<const RC::Unreal::UClass*>(current));
             }
+            it->second = std::move(chain);
+        }
+        return it->second;
+    }
+
+    /// Deliver a batch of notifications to matching subscribers, called without objectsLock
+    /// Classes may have been unloaded by now, so they are only compared by address
+    void DeliverNotifications(const std::vector<Notification>& batch) {
+        if (batch.empty()) return;
+
+        std::vector<std::shared_ptr<Subscription>> snapshot;
+        {
+            std::lock_guard lock(subscribersLock);
+            snapshot = subscribers;
         }
 
+        for (const Notification& notification : batch) {
+            for (const auto& subscription : snapshot) {
+                if (!(subscription->typeMask & static_cast<uint8_t>(notification.type))) continue;
+                if (subscription->filterClass && !InChain(notification.ancestry, subscription->filterClass)) continue;
+                if (!subscription->namePattern.empty() &&
+                    notification.info.name.find(subscription->namePattern) == std::wstring::npos) continue;
+
+                try {
+                    subscription->callback(notification);
+                } catch (...) {
+                    RC::Output::send<RC::LogLevel::Error>(STR("Lifetime subscriber {} threw an exception\n"),
+                        subscription->id);
+                }
+            }
+        }
+    }
+
+    /// Report deleted watched objects to the delete watchers, called without objectsLock
+    void DeliverDeletions(const std::vector<std::pair<const RC::Unreal::UObjectBase*, uint32_t>>& deletions) {
+        if (deletions.empty()) return;
+
+        std::vector<std::shared_ptr<std::pair<SubscriptionId, DeleteWatcher>>> snapshot;
+        {
+            std::lock_guard lock(subscribersLock);
+            snapshot = deleteWatchers;
+        }
+
+        for (const auto& [object, serial] : deletions) {
+            for (const auto& watcher : snapshot) {
+                try {
+                    watcher->second(object, serial);
+                } catch (...) {
+                    RC::Output::send<RC::LogLevel::Error>(STR("Delete watcher {} threw an exception\n"),
+                        watcher->first);
+                }
+            }
+        }
+    }
+
+    static bool InChain(const ClassChain& chain, const RC::Unreal::UClass* base) {
+        return chain && std::find(chain->begin(), chain->end(), base) != chain->end();
+    }
+
+    static bool IsChildOf(const RC::Unreal::UClass* objectClass, const RC::Unreal::UClass* base) {
+        for (const RC::Unreal::UStruct* current = objectClass; current; current = current->GetSuperStruct()) {
+            if (current == base) return true;
+        }
         return false;
     }
 
+    static std::wstring FoldCase(std::wstring text) {
+        std::transform(text.begin(), text.end(), text.begin(), ::towlower);
+        return text;
+    }
+
+    /// Name text without FName's "_N" number suffix
+    static std::wstring BaseName(const RC::Unreal::FName& name) {
+        std::wstring text = name.ToString();
+        if (name.GetNumber() != 0) {
+            auto suffix = text.find_last_of(L'_');
+            if (suffix != std::wstring::npos) text.resize(suffix);
+        }
+        return text;
+    }
+
+    /// Deferred maintenance step, objectsLock must be held
+    void RunMaintenance() {
+        events.Drain([this](const LifetimeEvent& event) {
+            Slot* slot = SlotAt(event.index);
+            if (!slot) return;
+
+            if (event.type == LifetimeEvent::Type::Created) {
+                // MINIMAL tracking - don't call any UObject methods yet
+                if (slot->object.load(std::memory_order_acquire) == event.object) {
+                    InitInfo(*slot, event.object, L"pending");
+                    pendingNames.push_back(event.index);
+                }
+            } else {
+                if (event.watched) {
+                    watchedDeletions.emplace_back(event.object, event.serial);
+                }
+                ForgetClass(event.object);
+                if (slot->info.address == reinterpret_cast<uintptr_t>(event.object)) {
+                    RetireSlot(*slot);
+                }
+            }
+        });
+
+        if (events.TakeOverflow()) {
+            // Deletions of watched objects may have been dropped with the rest
+            watchedDeletions.emplace_back(nullptr, 0);
+            Resync();
+        }
+
+        // New rules apply to objects that already exist too
+        if (rulesDirty) {
+            RebuildRules();
+            ForEachSlot([this](Slot& slot, RC::Unreal::int32) {
+                if (!slot.tracked && slot.info.isValid) {
+                    TrackIfMatching(slot);
+                }
+            });
+        }
+
+        // Evaluate rules and fill in names now that construction has finished
+        for (RC::Unreal::int32 index : pendingNames) {
+            Slot* slot = SlotAt(index);
+            if (slot->info.name == L"pending" && !slot->tracked) {
+                TrackIfMatching(*slot);
+            }
+        }
+        pendingNames.clear();
+    }
+
+    /// Drop memos keyed by a deleted object in case it was a class, its address can be reused
+    /// A tracked type that unloaded stops being tracked
+    void ForgetClass(const RC::Unreal::UObjectBase* object) {
+        const auto* deletedClass = reinterpret_cast<const RC::Unreal::UClass*>(object);
+        ancestryMasks.erase(deletedClass);
+        classChains.erase(deletedClass);
+        if (trackedTypes.erase(const_cast<RC::Unreal::UClass*>(deletedClass))) {
+            rulesDirty = true;
+        }
+    }
+
+    /// Drop the bookkeeping of a slot whose object was deleted
+    void RetireSlot(Slot& slot) {
+        if (slot.tracked) {
+            // The listener already cleared the slot, or a new object took it; report the dead one
+            slot.info.isValid = false;
+            Notify(Notification::Type::Deleted, slot,
+                reinterpret_cast<const RC::Unreal::UObjectBase*>(slot.info.address));
+        }
+        UnindexSlot(slot);
+        slot.info = ObjectInfo{};
+    }
+
+    /// Rebuild bookkeeping from the slot table after the event queue dropped events
+    /// The listeners publish every create and delete into the slots directly, so the table
+    /// is still exact; only notifications for objects that came and went in between are lost
+    void Resync() {
+        // Deleted classes may have been missed too
+        ancestryMasks.clear();
+        classChains.clear();
+
+        for (RC::Unreal::int32 chunk = 0; chunk < MaxChunks; ++chunk) {
+            Slot* slots = chunks[chunk].load(std::memory_order_acquire);
+            if (!slots) continue;
+            for (RC::Unreal::int32 i = 0; i < SlotsPerChunk; ++i) {
+                Slot& slot = slots[i];
+                const RC::Unreal::UObjectBase* object = slot.object.load(std::memory_order_acquire);
+                if (slot.info.address == reinterpret_cast<uintptr_t>(object)) continue;
+
+                if (slot.info.address != 0) {
+                    RetireSlot(slot);
+                }
+                if (object) {
+                    InitInfo(slot, object, L"pending");
+                    pendingNames.push_back(chunk * SlotsPerChunk + i);
+                }
+            }
+        }
+        RC::Output::send<RC::LogLevel::Warning>(
+            STR("[ObjectLifetimeTracker] Event queue overflowed, resynchronized ({} events dropped so far)\n"),
+            events.Dropped());
+    }
+
+    /// Visit every occupied slot with its index, erasing entries that began destruction
+    template<typename Callback>
+    void ForEachSlot(Callback&& callback) {
+        for (RC::Unreal::int32 chunk = 0; chunk < MaxChunks; ++chunk) {
+            Slot* slots = chunks[chunk].load(std::memory_order_acquire);
+            if (!slots) continue;
+            for (RC::Unreal::int32 i = 0; i < SlotsPerChunk; ++i) {
+                const RC::Unreal::UObjectBase* object = slots[i].object.load(std::memory_order_acquire);
+                if (!object) continue;
+
+                if (slots[i].info.isValid && IsBeingDestroyed(object)) {
+                    MarkDestroying(slots[i], object);
+                }
+                callback(slots[i], chunk * SlotsPerChunk + i);
+            }
+        }
+    }
+
+    /// Recompile the name automaton and reset the per-class and per-name memos
+    void RebuildRules() {
+        std::vector<std::wstring> patterns(trackedNames.begin(), trackedNames.end());
+        patterns.emplace_back(L"mainPlayer");   // Always track mainPlayer
+        nameMatcher.Build(patterns);
+        patternsSpanSuffix = std::any_of(patterns.begin(), patterns.end(), [](const std::wstring& pattern) {
+            return pattern.find_first_of(L"_0123456789") != std::wstring::npos;
+        });
+
+        typeBits.clear();
+        typeBits[RC::Unreal::AGameModeBase::StaticClass()] = 1;
+        uint64_t bit = 2;
+        for (auto trackedType : trackedTypes) {
+            typeBits[trackedType] |= bit;
+            if (bit != LastTypeBit) {
+                bit <<= 1;
+            }
+        }
+
+        ancestryMasks.clear();
+        nameMatches.clear();
+        rulesDirty = false;
+    }
+
+    /// Bitmask of the tracked types a class is or derives from, memoized per class
+    uint64_t AncestryMask(const RC::Unreal::UClass* objectClass) {
+        auto [it, inserted] = ancestryMasks.try_emplace(objectClass, 0);
+        if (inserted) {
+            for (const RC::Unreal::UStruct* current = objectClass; current; current = current->GetSuperStruct()) {
+                auto bits = typeBits.find(current);
+                if (bits != typeBits.end()) {
+                    it->second |= bits->second;
+                }
+            }
+        }
+        return it->second;
+    }
+
+    /// Check an object's full name against the compiled patterns
+    /// The base name, without FName's "_N" number suffix, is memoized per comparison index;
+    /// the full text is only scanned when a pattern could match across the suffix
+    bool NameMatches(const RC::Unreal::FName& name) {
+        auto [it, inserted] = nameMatches.try_emplace(name.GetComparisonIndex(), false);
+        if (inserted) {
+            it->second = nameMatcher.Matches(BaseName(name));
+        }
+        if (it->second || name.GetNumber() == 0 || !patternsSpanSuffix) {
+            return it->second;
+        }
+        return nameMatcher.Matches(name.ToString());
+    }
+
+    /// Determines if an object should be tracked based on type and name rules
+    /// @param uobject The object to evaluate
+    /// @return true if the object matches tracking criteria
+    bool ShouldTrackObject(RC::Unreal::UObject* uobject) {
+        if (!uobject) return false;
+
+        // GameMode and custom tracked types, one lookup for all of them
+        if (AncestryMask(uobject->GetClassPrivate()) != 0) {
+            return true;
+        }
+
+        return NameMatches(uobject->GetNamePrivate());
+    }
+
+    /// Mark a slot tracked if its object matches the rules and fill in its name and flags
+    void TrackIfMatching(Slot& slot) {
+        auto uobject = std::bit_cast<RC::Unreal::UObject*>(slot.object.load(std::memory_order_acquire));
+        if (!uobject) return;
+
+        try {
+            if (!ShouldTrackObject(uobject)) return;
+
+            slot.info.name = uobject->GetName();
+            slot.info.flags = uobject->GetObjectFlags();
+            IndexSlot(slot, uobject);
+        } catch (...) {
+            // If we can't update, just keep what we know
+        }
+    }
+
     /// Listener for object creation events
     struct CreateListener : RC::Unreal::FUObjectCreateListener {
         /// Called when a new UObject is created
@@ -298,20 +1394,8 @@ private:
             
             try {
                 auto& tracker = Get();
-                std::unique_lock lock(tracker.objectsLock, std::try_to_lock);
-                if (!lock.owns_lock()) {
-                    return; // Skip this object if we can't get lock immediately
-                }
-                
-                // MINIMAL tracking - don't call any UObject methods yet
-                ObjectInfo info;
-                info.isValid = true;
-                info.name = L"pending"; 
-                info.address = reinterpret_cast<uintptr_t>(Object);
-                info.flags = {};       
-                
-                tracker.liveObjects[Object] = info;
-                
+                tracker.PublishCreated(Object, Index);
+                tracker.events.Push({LifetimeEvent::Type::Created, Index, Object});
             } catch (...) {
                 
             }
@@ -329,15 +1413,17 @@ private:
             
             try {
                 auto& tracker = Get();
-                
-                // Quick exit if we can't get the lock
-                std::unique_lock lock(tracker.objectsLock, std::try_to_lock);
-                if (!lock.owns_lock()) {
-                    return; // Skip cleanup if we can't get lock immediately
+                LifetimeEvent event{LifetimeEvent::Type::Deleted, Index, Object};
+                if (Slot* slot = tracker.SlotAt(Index)) {
+                    event.serial = tracker.PublishDeleted(*slot, Index, Object);
+
+                    const RC::Unreal::UObjectBase* watched = Object;
+                    if (slot->watched.compare_exchange_strong(watched, nullptr, std::memory_order_acq_rel)) {
+                        event.watched = true;
+                        tracker.watchGeneration.fetch_add(1, std::memory_order_acq_rel);
+                    }
                 }
-                
-                tracker.liveObjects.erase(Object);
-                
+                tracker.events.Push(event);
             } catch (...) {
 
             }
@@ -354,4 +1440,72 @@ private:
     // Prevent copies
     ObjectLifetimeTracker(const ObjectLifetimeTracker&) = delete;
     ObjectLifetimeTracker& operator=(const ObjectLifetimeTracker&) = delete;
-};
\ No newline at end of file
+};
+
+/// Typed weak handle to a game object, validated through the tracker's slot table
+///
+/// Stores the object's UObjectArray index and slot serial next to the pointer, so a validity
+/// check is a bounds check and two compares with no lock and no hashing. Trivially copyable,
+/// meant to be kept in large containers in place of raw pointers.
+///
+/// Example usage:
+/// @code
+/// TrackedPtr<ATV> atv(player->atv);
+/// // ...frames later
+/// if (ATV* live = atv.Get()) {
+///     live->fuel = 100.0f;
+/// }
+/// @endcode
+template<typename T>
+class TrackedPtr {
+public:
+    TrackedPtr() = default;
+
+    /// Take a handle to an object, on the game thread
+    /// Objects created before the tracker was installed are added to it once GUObjectArray
+    /// confirms them; otherwise the handle is never valid
+    /// @param object The object to reference, may be null
+    explicit TrackedPtr(T* object) : object(object) {
+        if (!object) return;
+
+        auto& tracker = ObjectLifetimeTracker::Get();
+        serial = tracker.GetSerialNumber(object);
+        if (serial == 0 && tracker.TrackSpecificObject(object)) {
+            serial = tracker.GetSerialNumber(object);
+        }
+        index = object->GetInternalIndex();
+    }
+
+    /// Check if the referenced object is still alive and not pending destruction
+    bool IsValid() const {
+        return object && ObjectLifetimeTracker::Get().IsAlive(index, serial);
+    }
+
+    explicit operator bool() const { return IsValid(); }
+
+    /// Get the object if it's still alive
+    /// @return The typed object, or nullptr if it was destroyed
+    T* Get() const {
+        return IsValid() ? object : nullptr;
+    }
+
+    /// Access the object, null if it was destroyed
+    T* operator->() const { return Get(); }
+
+    /// Get the stored pointer without checking, for use as a key only
+    T* GetUnchecked() const { return object; }
+
+    RC::Unreal::int32 GetIndex() const { return index; }
+    uint32_t GetSerial() const { return serial; }
+
+    void Reset() { *this = TrackedPtr{}; }
+
+    bool operator==(const TrackedPtr&) const = default;
+
+private:
+    T* object{nullptr};
+    RC::Unreal::int32 index{INDEX_NONE};
+    uint32_t serial{0};
+};
+
+static_assert(std::is_trivially_copyable_v<TrackedPtr<RC::Unreal::UObject>>);
@@ -1,5 +1,25 @@
 #pragma once
 #include <Unreal/UObject.hpp>
+#include <Unreal/UClass.hpp>
+#include <Unreal/FText.hpp>
+#include <Unreal/UObjectGlobals.hpp>
+#include <DynamicOutput/Output.hpp>
+#include "ObjectLifetimeTracker.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <cwchar>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <unordered_map>
+#include <vector>
 
 struct FIntVector {
     int32_t X;
@@ -28,24 +48,693 @@ struct FIntVector2D {
     FIntVector2D& operator=(FIntVector2D&&) noexcept = default;
 };
 
+namespace votv::util {
+
+/// Inline cache owned by a single field accessor
+/// Holds the last binding the accessor used so the steady state never touches the shared table.
+/// A binding packs the tracker serial of the class it was resolved against with the offset,
+/// so checking it is one load and an ObjectLifetimeTracker::IsCurrent() call.
+struct FieldHint {
+    std::atomic<uint64_t> binding{0};       ///< Class serial in the high 32 bits, offset in the low 32
+
+    static constexpr uint64_t Pack(uint32_t serial, RC::Unreal::int32 offset) {
+        return (static_cast<uint64_t>(serial) << 32) | static_cast<uint32_t>(offset);
+    }
+
+    static constexpr uint32_t Serial(uint64_t binding) {
+        return static_cast<uint32_t>(binding >> 32);
+    }
+
+    /// Byte offset into the object, INDEX_NONE if the property is missing
+    static constexpr RC::Unreal::int32 Offset(uint64_t binding) {
+        return static_cast<RC::Unreal::int32>(static_cast<uint32_t>(binding));
+    }
+};
+
+/// 64-bit FNV-1a over the UTF-16 code units of a property name
+constexpr uint64_t HashFieldName(std::wstring_view name) {
+    uint64_t hash = 14695981039346656037ull;
+    for (wchar_t c : name) {
+        hash ^= static_cast<uint64_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/// Reflected property kind a field is expected to map to, used for binding validation
+enum class FieldKind : uint8_t {
+    Other,      ///< Not checked
+    Bool,
+    Byte,       ///< ByteProperty or EnumProperty
+    Int,
+    Float,
+    Name,
+    String,
+    Object,     ///< ObjectProperty or ClassProperty
+    Struct,
+    Text
+};
+
+template<typename T>
+constexpr FieldKind FieldKindOf() {
+    if constexpr (std::is_same_v<T, bool>) return FieldKind::Bool;
+    else if constexpr (std::is_same_v<T, uint8_t>) return FieldKind::Byte;
+    else if constexpr (std::is_same_v<T, int32_t>) return FieldKind::Int;
+    else if constexpr (std::is_same_v<T, float>) return FieldKind::Float;
+    else if constexpr (std::is_same_v<T, RC::Unreal::FName>) return FieldKind::Name;
+    else if constexpr (std::is_same_v<T, RC::Unreal::FString>) return FieldKind::String;
+    else if constexpr (std::is_same_v<T, RC::Unreal::FText>) return FieldKind::Text;
+    else if constexpr (std::is_pointer_v<T>) return FieldKind::Object;
+    else if constexpr (std::is_class_v<T>) return FieldKind::Struct;
+    else return FieldKind::Other;
+}
+
+/// Kind of a reflected property, from its property class name
+inline FieldKind FieldKindOf(RC::Unreal::FProperty* property) {
+    const std::wstring className = property->GetClass().GetFName().ToString();
+    if (className == STR("BoolProperty")) return FieldKind::Bool;
+    if (className == STR("ByteProperty") || className == STR("EnumProperty")) return FieldKind::Byte;
+    if (className == STR("IntProperty")) return FieldKind::Int;
+    if (className == STR("FloatProperty")) return FieldKind::Float;
+    if (className == STR("NameProperty")) return FieldKind::Name;
+    if (className == STR("StrProperty")) return FieldKind::String;
+    if (className == STR("ObjectProperty") || className == STR("ClassProperty")) return FieldKind::Object;
+    if (className == STR("StructProperty")) return FieldKind::Struct;
+    if (className == STR("TextProperty")) return FieldKind::Text;
+    return FieldKind::Other;
+}
+
+/// Type-erased description of a field declared with one of the UE4SS_*FIELD macros
+struct FieldInfo {
+    const wchar_t* name;        ///< Property name as it appears in the UE4SS dump
+    uint64_t hash;              ///< HashFieldName(name)
+    const char* typeName;       ///< C++ type as written in the declaration
+    size_t size;                ///< Size of the value stored in the object
+    FieldKind kind;             ///< Expected property kind
+    FieldHint* hint;            ///< The accessor's inline cache
+};
+
+/// Compile-time descriptor emitted for every declared field
+/// @tparam Owner The wrapper class declaring the field (void without UE4SS_CLASS)
+/// @tparam T The C++ type exposed by the accessor
+/// @tparam Storage The type stored in the object, differs from T for enums
+template<typename Owner, typename T, typename Storage = T>
+struct FieldDescriptor : FieldInfo {
+    using owner_type = Owner;
+    using value_type = T;
+    using storage_type = Storage;
+
+    constexpr FieldDescriptor(const wchar_t* fieldName, const char* fieldTypeName, FieldHint* fieldHint)
+        : FieldInfo{fieldName, HashFieldName(fieldName), fieldTypeName, sizeof(Storage),
+                    FieldKindOf<Storage>(), fieldHint} {}
+};
+
+/// Tag used to number the fields of a wrapper in declaration order
+template<int I>
+struct FieldIndex {};
+
+/// Most fields a single wrapper class can declare
+inline constexpr int MaxFieldsPerClass = 256;
+
+/// Overload rank the field macros use to number fields within their own class body
+///
+/// Every field declares votv_field_slot(FieldRank<index + 1>). Calling it with the highest rank
+/// picks the most derived overload declared so far, so the next field reads its index from the
+/// previous one. The first field of a class only sees the FieldRank<0> overload below, found
+/// through ADL, and starts at 0.
+template<int N>
+struct FieldRank : FieldRank<N - 1> {};
+template<>
+struct FieldRank<0> {};
+
+std::integral_constant<int, 0> votv_field_slot(FieldRank<0>);
+
+/// Field owner for classes without UE4SS_CLASS, UE4SS_CLASS declares a closer overload
+void* votv_field_owner(FieldRank<0>);
+
+/// Describes a wrapper class to FieldBinder
+///
+/// Defaults to the name declared by UE4SS_CLASS, and to that name with the blueprint "_C"
+/// suffix for the game class. Specialize it to describe a wrapper that does not use the macro
+/// or maps a class named differently.
+template<typename Wrapper>
+struct WrapperTraits {
+    static constexpr const wchar_t* name = [] {
+        if constexpr (requires { Wrapper::votv_wrapper_name; }) {
+            return Wrapper::votv_wrapper_name;
+        } else {
+            return STR("<unnamed wrapper>");
+        }
+    }();
+
+    /// Short name of the game class, empty if unknown
+    static std::wstring ClassName() {
+        if constexpr (requires { Wrapper::votv_wrapper_name; }) {
+            return std::wstring(Wrapper::votv_wrapper_name) + STR("_C");
+        } else {
+            return {};
+        }
+    }
+};
+
+/// Number of fields declared in a wrapper class
+template<typename Wrapper, int I = 0>
+constexpr size_t FieldCount() {
+    if constexpr (requires { Wrapper::votv_field(FieldIndex<I>{}); }) {
+        return FieldCount<Wrapper, I + 1>();
+    } else {
+        return I;
+    }
+}
+
+/// All fields declared in a wrapper class, in declaration order
+/// @code
+/// constexpr auto fields = FieldsOf<game::MainPlayer>();
+/// static_assert(fields[0].hash == HashFieldName(L"underwaterPlayer"));
+/// @endcode
+template<typename Wrapper>
+constexpr auto FieldsOf() {
+    return []<size_t... I>(std::index_sequence<I...>) {
+        return std::array<FieldInfo, sizeof...(I)>{
+            static_cast<const FieldInfo&>(Wrapper::votv_field(FieldIndex<static_cast<int>(I)>{}))...
+        };
+    }(std::make_index_sequence<FieldCount<Wrapper>()>{});
+}
+
+/// Process-wide cache of property offsets keyed by (UClass, property name)
+///
+/// Entries are filled on first access. Each class's entries remember the serial
+/// ObjectLifetimeTracker::WatchObject() gave the class, and bindings only match while the
+/// class still holds it, so a class unloaded and another loaded at the same address never
+/// reuses the old offsets. The entries of a deleted class are freed once the deletion is
+/// delivered through ProcessPendingEvents().
+class FieldOffsetCache {
+public:
+    static FieldOffsetCache& Get() {
+        static FieldOffsetCache instance;
+        return instance;
+    }
+
+    /// Get a typed pointer to a property of an object
+    /// @param object The object to read from
+    /// @param field Descriptor of the field, its hint is used as the inline cache
+    /// @return Pointer into the object, or nullptr if the property doesn't exist on its class
+    template<typename T>
+    static T* Resolve(const RC::Unreal::UObject* object, const FieldInfo& field) {
+        if (!object) return nullptr;
+
+        auto* objectClass = object->GetClassPrivate();
+        uint64_t binding = field.hint->binding.load(std::memory_order_acquire);
+        if (!ObjectLifetimeTracker::Get().IsCurrent(objectClass, FieldHint::Serial(binding))) {
+            binding = Get().Lookup(objectClass, field.name, field.hash);
+            field.hint->binding.store(binding, std::memory_order_release);
+        }
+
+        const RC::Unreal::int32 offset = FieldHint::Offset(binding);
+        if (offset == INDEX_NONE) return nullptr;
+        auto* base = reinterpret_cast<uint8_t*>(const_cast<RC::Unreal::UObject*>(object));
+        return reinterpret_cast<T*>(base + offset);
+    }
+
+    /// Find or resolve the binding for a property on a class
+    /// @param objectClass The class to resolve against, e.g. the class of a live object
+    /// @param name The property name
+    /// @param hash HashFieldName(name), precomputed by field descriptors
+    /// @return Packed binding, see FieldHint; its serial is 0 if the class can't be watched
+    uint64_t Lookup(RC::Unreal::UClass* objectClass, const wchar_t* name, uint64_t hash) {
+        if (!objectClass) return FieldHint::Pack(0, INDEX_NONE);
+
+        {
+            std::shared_lock lock(cacheLock);
+            auto owner = classes.find(objectClass);
+            if (owner != classes.end() && ObjectLifetimeTracker::Get().IsCurrent(objectClass, owner->second)) {
+                auto it = bindings.find(FieldKeyView{objectClass, hash, name});
+                if (it != bindings.end()) {
+                    return FieldHint::Pack(owner->second, it->second);
+                }
+            }
+        }
+
+        // Walk the chain outside the lock so concurrent resolves don't serialize
+        RC::Unreal::int32 offset = INDEX_NONE;
+        if (auto* property = objectClass->GetPropertyByNameInChain(name)) {
+            offset = property->GetOffset_Internal();
+        }
+        return Store(objectClass, name, hash, offset);
+    }
+
+    /// Record an offset resolved by the caller
+    /// @param objectClass The class the offset belongs to, e.g. the class of a live object
+    /// @param name The property name, must outlive the call only
+    /// @param hash HashFieldName(name)
+    /// @param offset Byte offset of the property, INDEX_NONE if it doesn't exist
+    /// @return Packed binding, see FieldHint; its serial is 0 if the class can't be watched
+    uint64_t Store(RC::Unreal::UClass* objectClass, const wchar_t* name, uint64_t hash,
+                   RC::Unreal::int32 offset) {
+        if (!objectClass) return FieldHint::Pack(0, INDEX_NONE);
+
+        // Nothing would report an unregistered class unloading, so don't keep entries for it
+        const uint32_t serial = ObjectLifetimeTracker::Get().WatchObject(objectClass);
+        if (serial == 0) return FieldHint::Pack(0, offset);
+
+        std::unique_lock lock(cacheLock);
+        auto [owner, inserted] = classes.try_emplace(objectClass, serial);
+        if (!inserted && owner->second != serial) {
+            // Left over from an unloaded class at the same address
+            EraseBindings(objectClass);
+            owner->second = serial;
+        }
+        bindings.insert_or_assign(FieldKey{objectClass, hash, name}, offset);
+        return FieldHint::Pack(serial, offset);
+    }
+
+    /// Find or resolve the binding for a property on a class, hashing the name at runtime
+    uint64_t Lookup(RC::Unreal::UClass* objectClass, const wchar_t* name) {
+        return Lookup(objectClass, name, HashFieldName(name));
+    }
+
+    /// Drop every binding resolved against a class
+    /// Not needed when a class unloads, that is detected through the tracker
+    void Invalidate(const RC::Unreal::UClass* objectClass) {
+        std::unique_lock lock(cacheLock);
+        if (classes.erase(objectClass)) {
+            EraseBindings(objectClass);
+        }
+    }
+
+    /// Drop every binding
+    void Clear() {
+        std::unique_lock lock(cacheLock);
+        bindings.clear();
+        classes.clear();
+    }
+
+private:
+    struct FieldKey {
+        const RC::Unreal::UClass* owner;
+        uint64_t hash;
+        std::wstring name;
+    };
+
+    /// Non-owning key so lookups don't build a std::wstring
+    struct FieldKeyView {
+        const RC::Unreal::UClass* owner;
+        uint64_t hash;
+        std::wstring_view name;
+
+        FieldKeyView(const RC::Unreal::UClass* keyOwner, uint64_t keyHash, std::wstring_view keyName)
+            : owner(keyOwner), hash(keyHash), name(keyName) {}
+        FieldKeyView(const FieldKey& key) : owner(key.owner), hash(key.hash), name(key.name) {}
+    };
+
+    struct FieldKeyHash {
+        using is_transparent = void;
+        size_t operator()(FieldKeyView key) const noexcept {
+            return static_cast<size_t>(key.hash) ^ (std::hash<const void*>{}(key.owner) << 1);
+        }
+    };
+
+    struct FieldKeyEqual {
+        using is_transparent = void;
+        bool operator()(FieldKeyView lhs, FieldKeyView rhs) const noexcept {
+            // Hash first, the name compare only runs on a real match or a collision
+            return lhs.hash == rhs.hash && lhs.owner == rhs.owner && lhs.name == rhs.name;
+        }
+    };
+
+    std::unordered_map<FieldKey, RC::Unreal::int32, FieldKeyHash, FieldKeyEqual> bindings;
+    std::unordered_map<const RC::Unreal::UClass*, uint32_t> classes;     ///< Serial of each class with bindings
+    std::shared_mutex cacheLock;
+    ObjectLifetimeTracker::SubscriptionId watcher{0};
+
+    /// cacheLock must be held exclusively
+    void EraseBindings(const RC::Unreal::UClass* objectClass) {
+        std::erase_if(bindings, [objectClass](const auto& entry) {
+            return entry.first.owner == objectClass;
+        });
+    }
+
+    /// Only the address of the deleted class is used, it's dangling by now
+    void OnClassDeleted(const RC::Unreal::UObjectBase* object, uint32_t serial) {
+        if (!object) {
+            Clear();
+            return;
+        }
+
+        const auto* objectClass = reinterpret_cast<const RC::Unreal::UClass*>(object);
+        std::unique_lock lock(cacheLock);
+        auto owner = classes.find(objectClass);
+        if (owner == classes.end() || (serial != 0 && owner->second != serial)) return;
+
+        classes.erase(owner);
+        EraseBindings(objectClass);
+    }
+
+    FieldOffsetCache() {
+        watcher = ObjectLifetimeTracker::Get().AddDeleteWatcher(
+            [this](const RC::Unreal::UObjectBase* object, uint32_t serial) { OnClassDeleted(object, serial); });
+    }
+
+    ~FieldOffsetCache() {
+        ObjectLifetimeTracker::Get().RemoveDeleteWatcher(watcher);
+    }
+
+    // Prevent copies
+    FieldOffsetCache(const FieldOffsetCache&) = delete;
+    FieldOffsetCache& operator=(const FieldOffsetCache&) = delete;
+};
+
+
+/// Declarative bulk reader that copies several properties of an object into a plain struct
+///
+/// The property offsets for all fields are resolved in a single pass over the class and
+/// kept per class while the class is loaded, so a read is one class check plus a copy per
+/// field. Reading objects of several classes in turn reuses their layouts.
+///
+/// Example usage:
+/// @code
+/// static const FieldSnapshot<PowerInfo> layout{
+///     {&PowerInfo::total, STR("totalPower")},
+///     {&PowerInfo::used, STR("usedPower")},
+/// };
+/// PowerInfo info = layout.Read(this);
+/// @endcode
+template<typename Snapshot>
+class FieldSnapshot {
+public:
+    /// Maps one snapshot member to a property on the object
+    struct Field {
+        const wchar_t* name;    ///< Property name
+        size_t destOffset;      ///< Offset of the member in Snapshot
+        size_t size;            ///< Bytes to copy
+        size_t subOffset;       ///< Offset inside the property, for reading a single component
+
+        /// @param member Snapshot member to fill
+        /// @param propertyName Property to copy from
+        /// @param propertySubOffset Byte offset inside the property (e.g. offsetof(FIntVector, Z))
+        template<typename M>
+        Field(M Snapshot::* member, const wchar_t* propertyName, size_t propertySubOffset = 0)
+            : name(propertyName),
+              destOffset(MemberOffset(member)),
+              size(sizeof(M)),
+              subOffset(propertySubOffset) {}
+    };
+
+    FieldSnapshot(std::initializer_list<Field> snapshotFields) : fields(snapshotFields) {}
+
+    /// Copy all described fields out of an object
+    /// @param object The object to read from
+    /// @return Filled snapshot, members whose property is missing are value-initialized
+    Snapshot Read(const RC::Unreal::UObject* object) const {
+        Snapshot result{};
+        if (!object) return result;
+
+        auto* objectClass = object->GetClassPrivate();
+        const Layout* current = layout.load(std::memory_order_acquire);
+        Layout unwatched;
+        if (!current || current->owner != objectClass ||
+            !ObjectLifetimeTracker::Get().IsCurrent(objectClass, current->serial)) {
+            current = Resolve(objectClass, unwatched);
+        }
+
+        auto* source = reinterpret_cast<const uint8_t*>(object);
+        auto* dest = reinterpret_cast<uint8_t*>(&result);
+        for (size_t i = 0; i < fields.size(); ++i) {
+            if (current->offsets[i] == INDEX_NONE) continue;
+            std::memcpy(dest + fields[i].destOffset,
+                        source + current->offsets[i] + fields[i].subOffset,
+                        fields[i].size);
+        }
+        return result;
+    }
+
+private:
+    struct Layout {
+        RC::Unreal::UClass* owner{nullptr};
+        uint32_t serial{0};                 ///< Tracker serial of owner when the layout was built
+        std::vector<RC::Unreal::int32> offsets;
+    };
+
+    std::vector<Field> fields;
+    mutable std::atomic<const Layout*> layout{nullptr};
+    mutable std::deque<Layout> storage;     ///< Stable backing store, readers may still hold older layouts
+    mutable std::unordered_map<RC::Unreal::UClass*, const Layout*> byClass;    ///< Newest layout per class
+    mutable std::mutex storageLock;
+
+    template<typename M>
+    static size_t MemberOffset(M Snapshot::* member) {
+        static const Snapshot probe{};
+        return static_cast<size_t>(reinterpret_cast<const uint8_t*>(&(probe.*member)) -
+                                   reinterpret_cast<const uint8_t*>(&probe));
+    }
+
+    /// Find the layout for the class as it's loaded now, resolving it if there's none
+    /// @param scratch Receives the layout of a class the tracker can't watch, which isn't kept
+    const Layout* Resolve(RC::Unreal::UClass* objectClass, Layout& scratch) const {
+        const uint32_t serial = ObjectLifetimeTracker::Get().WatchObject(objectClass);
+        if (serial == 0) {
+            scratch = Build(objectClass, 0);
+            return &scratch;
+        }
+
+        std::lock_guard lock(storageLock);
+        const Layout*& entry = byClass[objectClass];
+        if (!entry || entry->serial != serial) {
+            entry = &storage.emplace_back(Build(objectClass, serial));
+        }
+        layout.store(entry, std::memory_order_release);
+        return entry;
+    }
+
+    /// Resolve every field against a class with one walk over its property chain
+    Layout Build(RC::Unreal::UClass* objectClass, uint32_t serial) const {
+        Layout resolved;
+        resolved.owner = objectClass;
+        resolved.serial = serial;
+        resolved.offsets.assign(fields.size(), INDEX_NONE);
+
+        if (objectClass) {
+            size_t remaining = fields.size();
+            for (RC::Unreal::FProperty* property : objectClass->ForEachPropertyInChain()) {
+                std::wstring propertyName = property->GetName();
+                for (size_t i = 0; i < fields.size(); ++i) {
+                    // First match wins, same as GetPropertyByNameInChain
+                    if (resolved.offsets[i] == INDEX_NONE && propertyName == fields[i].name) {
+                        resolved.offsets[i] = property->GetOffset_Internal();
+                        --remaining;
+                    }
+                }
+                if (remaining == 0) break;
+            }
+        }
+        return resolved;
+    }
+};
+
+/// A problem found while binding a wrapper's fields to a class
+struct FieldBindIssue {
+    enum class Type {
+        ClassNotFound,      ///< No class was given and none was found by name
+        MissingField,       ///< The class has no property with the field's name
+        SizeMismatch,       ///< The property's element size differs from the C++ type
+        TypeMismatch        ///< The property kind doesn't match the C++ type
+    };
+
+    Type type;
+    const wchar_t* wrapper;
+    const wchar_t* field{nullptr};
+    std::wstring detail;
+};
+
+/// Outcome of FieldBinder::Run()
+struct FieldBindReport {
+    size_t bound{0};                        ///< Fields resolved and cached
+    std::vector<FieldBindIssue> issues;
+
+    bool ok() const { return issues.empty(); }
+};
+
+/// One-shot resolver that binds every declared field of a set of wrappers up front
+///
+/// Each wrapper is resolved against its UClass, filling the offset cache and every accessor's
+/// inline cache. Wrappers added without a class are looked up by WrapperTraits::ClassName()
+/// in one pass over GUObjectArray. Missing classes and properties and size/type mismatches are
+/// collected and logged as one batch instead of surfacing as silent default values later.
+///
+/// Run() reads reflection data and must be called on the game thread.
+///
+/// Example usage:
+/// @code
+/// FieldBinder binder;
+/// binder.Add<GrowingPlant>(plant->GetClassPrivate())
+///       .Add<Padlock>();      // looked up as "Padlock_C"
+/// auto report = binder.Run();
+/// @endcode
+class FieldBinder {
+public:
+    /// Queue a wrapper for binding
+    /// @tparam Wrapper A class declaring fields, named through WrapperTraits
+    /// @param objectClass The game class the wrapper maps, nullptr looks it up by name in Run()
+    template<typename Wrapper>
+    FieldBinder& Add(RC::Unreal::UClass* objectClass = nullptr) {
+        static constexpr auto fields = FieldsOf<Wrapper>();
+        entries.push_back({WrapperTraits<Wrapper>::name, objectClass,
+                           objectClass ? std::wstring{} : WrapperTraits<Wrapper>::ClassName(),
+                           fields.data(), fields.size()});
+        return *this;
+    }
+
+    /// Resolve all queued wrappers on the calling thread and log the issues found
+    /// Call from the game thread, e.g. a BeginPlay hook
+    FieldBindReport Run() const {
+        const std::vector<RC::Unreal::UClass*> classes = ResolveClasses();
+
+        FieldBindReport report;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            FieldBindReport partial = Bind(entries[i], classes[i]);
+            report.bound += partial.bound;
+            std::move(partial.issues.begin(), partial.issues.end(), std::back_inserter(report.issues));
+        }
+
+        for (const FieldBindIssue& issue : report.issues) {
+            RC::Output::send<RC::LogLevel::Warning>(STR("[FieldBinder] {}::{}: {}\n"),
+                issue.wrapper, issue.field ? issue.field : STR("-"), issue.detail);
+        }
+        RC::Output::send<RC::LogLevel::Verbose>(STR("[FieldBinder] Bound {} fields, {} issues\n"),
+            report.bound, report.issues.size());
+        return report;
+    }
+
+private:
+    struct Entry {
+        const wchar_t* wrapper;
+        RC::Unreal::UClass* objectClass;
+        std::wstring className;             ///< Looked up when objectClass is null
+        const FieldInfo* fields;
+        size_t count;
+    };
+
+    std::vector<Entry> entries;
+
+    /// Class of every entry, finding the ones added by name with one walk over GUObjectArray
+    std::vector<RC::Unreal::UClass*> ResolveClasses() const {
+        std::vector<RC::Unreal::UClass*> classes(entries.size(), nullptr);
+        std::unordered_map<uint32_t, std::vector<size_t>> wanted;   // FName comparison index -> entries
+        for (size_t i = 0; i < entries.size(); ++i) {
+            classes[i] = entries[i].objectClass;
+            if (classes[i] || entries[i].className.empty()) continue;
+
+            // A name that was never added can't belong to a loaded class
+            RC::Unreal::FName name(entries[i].className.c_str(), RC::Unreal::FNAME_Find);
+            if (name.GetComparisonIndex() != 0) {
+                wanted[name.GetComparisonIndex()].push_back(i);
+            }
+        }
+        if (wanted.empty()) return classes;
+
+        RC::Unreal::UObjectGlobals::ForEachUObject(
+            [&](RC::Unreal::UObject* object, RC::Unreal::int32, RC::Unreal::int32) {
+                auto it = wanted.find(object->GetNamePrivate().GetComparisonIndex());
+                if (it != wanted.end() && object->IsA<RC::Unreal::UClass>()) {
+                    for (size_t i : it->second) {
+                        classes[i] = static_cast<RC::Unreal::UClass*>(object);
+                    }
+                    wanted.erase(it);
+                }
+                return wanted.empty() ? RC::LoopAction::Break : RC::LoopAction::Continue;
+            });
+        return classes;
+    }
+
+    static FieldBindReport Bind(const Entry& entry, RC::Unreal::UClass* objectClass) {
+        FieldBindReport report;
+        if (!objectClass) {
+            report.issues.push_back({FieldBindIssue::Type::ClassNotFound, entry.wrapper, nullptr,
+                entry.className.empty() ? std::wstring(STR("no class to bind against"))
+                                        : STR("no class named ") + entry.className});
+            return report;
+        }
+
+        auto& cache = FieldOffsetCache::Get();
+        for (size_t i = 0; i < entry.count; ++i) {
+            const FieldInfo& field = entry.fields[i];
+            auto* property = objectClass->GetPropertyByNameInChain(field.name);
+            auto offset = property ? property->GetOffset_Internal() : INDEX_NONE;
+            field.hint->binding.store(cache.Store(objectClass, field.name, field.hash, offset),
+                                      std::memory_order_release);
+
+            if (!property) {
+                report.issues.push_back({FieldBindIssue::Type::MissingField, entry.wrapper, field.name,
+                                         STR("property not found")});
+                continue;
+            }
+
+            ++report.bound;
+            const auto elementSize = static_cast<size_t>(property->GetElementSize());
+            if (elementSize != field.size) {
+                report.issues.push_back({FieldBindIssue::Type::SizeMismatch, entry.wrapper, field.name,
+                    STR("property is ") + std::to_wstring(elementSize) + STR(" bytes, ") +
+                    std::wstring(field.typeName, field.typeName + std::strlen(field.typeName)) +
+                    STR(" is ") + std::to_wstring(field.size)});
+            }
+
+            const FieldKind actual = FieldKindOf(property);
+            if (field.kind != FieldKind::Other && actual != FieldKind::Other && actual != field.kind) {
+                report.issues.push_back({FieldBindIssue::Type::TypeMismatch, entry.wrapper, field.name,
+                    STR("property is ") + property->GetClass().GetFName().ToString()});
+            }
+        }
+        return report;
+    }
+};
+}
+
+// Names a wrapper class and makes it the owner_type of its field descriptors
+// Optional, fields declared without it are still enumerable and their owner_type is void
+#define UE4SS_CLASS(CLASS) \
+    static constexpr const wchar_t* votv_wrapper_name = STR(#CLASS); \
+    static CLASS* votv_field_owner(votv::util::FieldRank<0>)
+
+// Emits the inline cache and compile-time descriptor for a field
+// Fields are numbered in declaration order within the class body
+#define UE4SS_FIELD_DESCRIPTOR(TYPE, STORAGE, PROP_NAME, MEMBER_NAME) \
+    static constexpr int MEMBER_NAME##_index_ = \
+        decltype(votv_field_slot(votv::util::FieldRank<votv::util::MaxFieldsPerClass>{}))::value; \
+    static_assert(MEMBER_NAME##_index_ < votv::util::MaxFieldsPerClass, "Too many fields in one wrapper"); \
+    static std::integral_constant<int, MEMBER_NAME##_index_ + 1> \
+        votv_field_slot(votv::util::FieldRank<MEMBER_NAME##_index_ + 1>); \
+    static inline votv::util::FieldHint MEMBER_NAME##_hint_{}; \
+    static constexpr votv::util::FieldDescriptor< \
+        std::remove_pointer_t<decltype(votv_field_owner(votv::util::FieldRank<0>{}))>, TYPE, STORAGE> \
+        MEMBER_NAME##_field{STR(#PROP_NAME), #TYPE, &MEMBER_NAME##_hint_}; \
+    static constexpr const auto& votv_field(votv::util::FieldIndex<MEMBER_NAME##_index_>) { \
+        return MEMBER_NAME##_field; \
+    }
+
+// Resolve a property through the accessor's inline cache
+#define UE4SS_FIELD_RESOLVE(TYPE, MEMBER_NAME) \
+    votv::util::FieldOffsetCache::Resolve<TYPE>(this, MEMBER_NAME##_field)
+
 // Macro for pointer type fields
 #define UE4SS_FIELD_PTR(TYPE, NAME) \
+    UE4SS_FIELD_DESCRIPTOR(TYPE*, TYPE*, NAME, NAME) \
+    \
     void set_##NAME(TYPE* value) \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<TYPE*>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(TYPE*, NAME); \
         if (ptr) { *ptr = value; } \
     } \
     \
     TYPE* get_##NAME() \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<TYPE*>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(TYPE*, NAME); \
         static TYPE* default_value{}; \
         return ptr ? *ptr : default_value; \
     } \
     \
     const TYPE* get_##NAME() const \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<TYPE*>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(TYPE*, NAME); \
         static TYPE* default_value{}; \
         return ptr ? *ptr : default_value; \
     } \
@@ -53,22 +742,24 @@ struct FIntVector2D {
 
 // Macro for value type fields
 #define UE4SS_FIELD(TYPE, NAME) \
+    UE4SS_FIELD_DESCRIPTOR(TYPE, TYPE, NAME, NAME) \
+    \
     void set_##NAME(TYPE value) \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<TYPE>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(TYPE, NAME); \
         if (ptr) { *ptr = value; } \
     } \
     \
     TYPE get_##NAME() \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<TYPE>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(TYPE, NAME); \
         static TYPE default_value{}; \
         return ptr ? *ptr : default_value; \
     } \
     \
     TYPE get_##NAME() const \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<TYPE>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(TYPE, NAME); \
         static TYPE default_value{}; \
         return ptr ? *ptr : default_value; \
     } \
@@ -76,84 +767,92 @@ struct FIntVector2D {
 
 // Vector field access
 #define UE4SS_VECTOR_FIELD(NAME) \
+    UE4SS_FIELD_DESCRIPTOR(RC::Unreal::FVector, RC::Unreal::FVector, NAME, NAME) \
+    \
     void set_##NAME(const RC::Unreal::FVector& value) \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<RC::Unreal::FVector>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(RC::Unreal::FVector, NAME); \
         if (ptr) { *ptr = value; } \
     } \
     \
     RC::Unreal::FVector get_##NAME() const \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<RC::Unreal::FVector>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(RC::Unreal::FVector, NAME); \
         return ptr ? *ptr : RC::Unreal::FVector{}; \
     } \
     __declspec(property(get = get_##NAME, put = set_##NAME)) RC::Unreal::FVector NAME
 
 // Int vector field access with component getters
 #define UE4SS_INT_VECTOR_FIELD(NAME) \
+    UE4SS_FIELD_DESCRIPTOR(FIntVector, FIntVector, NAME, NAME) \
+    \
     void set_##NAME(const FIntVector& value) \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<FIntVector>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(FIntVector, NAME); \
         if (ptr) { *ptr = value; } \
     } \
     \
     void set_##NAME(int32_t x, int32_t y, int32_t z) \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<FIntVector>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(FIntVector, NAME); \
         if (ptr) { ptr->X = x; ptr->Y = y; ptr->Z = z; } \
     } \
     \
     FIntVector get_##NAME() const \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<FIntVector>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(FIntVector, NAME); \
         return ptr ? *ptr : FIntVector{}; \
     } \
     \
     int32_t get_##NAME##_x() const \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<FIntVector>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(FIntVector, NAME); \
         return ptr ? ptr->X : 0; \
     } \
     \
     int32_t get_##NAME##_y() const \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<FIntVector>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(FIntVector, NAME); \
         return ptr ? ptr->Y : 0; \
     } \
     \
     int32_t get_##NAME##_z() const \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<FIntVector>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(FIntVector, NAME); \
         return ptr ? ptr->Z : 0; \
     } \
     __declspec(property(get = get_##NAME, put = set_##NAME)) FIntVector NAME
 
 // Enum field access
 #define UE4SS_ENUM_FIELD(ENUM_TYPE, NAME) \
+    UE4SS_FIELD_DESCRIPTOR(ENUM_TYPE, uint8_t, NAME, NAME) \
+    \
     void set_##NAME(ENUM_TYPE value) \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<uint8_t>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(uint8_t, NAME); \
         if (ptr) { *ptr = static_cast<uint8_t>(value); } \
     } \
     \
     ENUM_TYPE get_##NAME() const \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<uint8_t>(STR(#NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(uint8_t, NAME); \
         return ptr ? static_cast<ENUM_TYPE>(*ptr) : static_cast<ENUM_TYPE>(0); \
     } \
     __declspec(property(get = get_##NAME, put = set_##NAME)) ENUM_TYPE NAME
 
 // Enum field access with custom member name
 #define UE4SS_ENUM_FIELD_NAME(ENUM_TYPE, PROP_NAME, MEMBER_NAME) \
+    UE4SS_FIELD_DESCRIPTOR(ENUM_TYPE, uint8_t, PROP_NAME, MEMBER_NAME) \
+    \
     void set_##MEMBER_NAME(ENUM_TYPE value) \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<uint8_t>(STR(#PROP_NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(uint8_t, MEMBER_NAME); \
         if (ptr) { *ptr = static_cast<uint8_t>(value); } \
     } \
     \
     ENUM_TYPE get_##MEMBER_NAME() const \
     { \
-        auto* ptr = const_cast<UObject*>(static_cast<const UObject*>(this))->GetValuePtrByPropertyNameInChain<uint8_t>(STR(#PROP_NAME)); \
+        auto* ptr = UE4SS_FIELD_RESOLVE(uint8_t, MEMBER_NAME); \
         return ptr ? static_cast<ENUM_TYPE>(*ptr) : static_cast<ENUM_TYPE>(0); \
     } \
     __declspec(property(get = get_##MEMBER_NAME, put = set_##MEMBER_NAME)) ENUM_TYPE MEMBER_NAME
\ No newline at end of file
@@ -169,6 +169,8 @@ namespace votv::game {
     // Main Game Mode class
     class GameMode : public RC::Unreal::AGameMode {
     public:
+        UE4SS_CLASS(GameMode);
+
         // Direct field access
         UE4SS_FIELD(MainPlayer*, mainPlayer);
         UE4SS_FIELD(SaveSlot*, saveSlot);
@@ -248,22 +250,25 @@ namespace votv::game {
         };
 
         PowerInfo GetPowerInfo() const {
-            return {
-                powerCalculating,
-                powerDownloading,
-                powerCoordinates,
-                powerPlaying,
-                powerLight,
-                totalPower,
-                usedPower,
-                powerRatio
+            static const votv::util::FieldSnapshot<PowerInfo> layout{
+                {&PowerInfo::calculating, STR("powerCalculating")},
+                {&PowerInfo::downloading, STR("powerDownloading")},
+                {&PowerInfo::coordinates, STR("powerCoordinates")},
+                {&PowerInfo::playing, STR("powerPlaying")},
+                {&PowerInfo::light, STR("powerLight")},
+                {&PowerInfo::total, STR("totalPower")},
+                {&PowerInfo::used, STR("usedPower")},
+                {&PowerInfo::ratio, STR("powerRatio")}
             };
+            return layout.Read(this);
         }
     };
 
     // Main Player class
     class MainPlayer : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(MainPlayer);
+
         UE4SS_FIELD(bool, underwaterPlayer);      // was: underwater
         UE4SS_FIELD(bool, inWater);
         UE4SS_FIELD(bool, noclip);
@@ -398,26 +403,30 @@ namespace votv::game {
         };
 
         PlayerState GetState() const {
-            return {
-                this->inWater,
-                this->underwaterPlayer,
-                this->noclip,
-                this->crouching,
-                this->dead,
-                this->air,
-                this->isWakingUp,
-                this->foodDrain,
-                this->sleepDrain,
-                this->mirror,
-                this->combat,
-                this->hasGlasses,
-                this->hasFlashlight
+            static const votv::util::FieldSnapshot<PlayerState> layout{
+                {&PlayerState::inWater, STR("inWater")},
+                {&PlayerState::underwaterPlayer, STR("underwaterPlayer")},
+                {&PlayerState::noclip, STR("noclip")},
+                {&PlayerState::crouching, STR("crouching")},
+                {&PlayerState::dead, STR("dead")},
+                {&PlayerState::air, STR("air")},
+                {&PlayerState::wakingUp, STR("isWakingUp")},
+                {&PlayerState::foodDrain, STR("foodDrain")},
+                {&PlayerState::sleepDrain, STR("sleepDrain")},
+                {&PlayerState::mirror, STR("mirror")},
+                {&PlayerState::combat, STR("combat")},
+                {&PlayerState::hasGlasses, STR("hasGlasses")},
+                {&PlayerState::hasFlashlight, STR("hasFlashlight")}
             };
+            return layout.Read(this);
         }
     };
 
     class Prop_Hook : public RC::Unreal::AActor
     {
+    public:
+        UE4SS_CLASS(Prop_Hook);
+
         UE4SS_FIELD(float, dist);
         UE4SS_FIELD(bool, attached_a);
         UE4SS_FIELD(bool, attached_b);
@@ -433,6 +442,8 @@ namespace votv::game {
     // ATV class (renamed from Car/car1 in 0.9.0)
     class ATV : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(ATV);
+
         UE4SS_FIELD(bool, isDriving);
         UE4SS_FIELD(float, fuel);
         UE4SS_FIELD(bool, broken);
@@ -501,6 +512,8 @@ namespace votv::game {
     // Kerfur Omega class
     class KerfurOmega : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(KerfurOmega);
+
         UE4SS_FIELD(bool, sentient);
         UE4SS_FIELD(float, meow);
         UE4SS_FIELD(bool, skipFaceAssign);
@@ -509,6 +522,8 @@ namespace votv::game {
     // Base prop class
     class Prop : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(Prop);
+
         UE4SS_FIELD(GameMode*, gameMode);
         UE4SS_FIELD(RC::Unreal::FName, Name);
         UE4SS_FIELD(PropStruct, propData);
@@ -526,6 +541,8 @@ namespace votv::game {
     // Door class
     class Door : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(Door);
+
         UE4SS_FIELD(bool, isOpened);
         UE4SS_FIELD(bool, isMoving);
         UE4SS_FIELD(bool, isActive);
@@ -541,6 +558,8 @@ namespace votv::game {
     // Game Instance class (renamed from GameInst/gameInst in 0.9.0)
     class GameInstance : public RC::Unreal::UObject {
     public:
+        UE4SS_CLASS(GameInstance);
+
         UE4SS_FIELD(SaveSlot*, save_gameInst);    // was: save
         UE4SS_FIELD(RC::Unreal::FString, SlotName);
         UE4SS_FIELD(bool, opened);
@@ -568,6 +587,8 @@ namespace votv::game {
 
     class SaveSlot : public RC::Unreal::UObject {
     public:
+        UE4SS_CLASS(SaveSlot);
+
         UE4SS_FIELD(float, totalTime);
         UE4SS_FIELD(float, food);
         UE4SS_FIELD(float, sleep);
@@ -590,6 +611,8 @@ namespace votv::game {
     // Day/Night Cycle class
     class DayNightCycle : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(DayNightCycle);
+
         // Time fields
         UE4SS_INT_VECTOR_FIELD(timeZ);
         // Create easy access to Z component which represents the day
@@ -662,18 +685,36 @@ namespace votv::game {
 
 
         TimeInfo GetTimeInfo() const {
-            return {
-                current_day(), day, phase, phaseSin, phaseNormSin,
-                maxTime, totalTime, timeScale, sleepingTimeDilation
+            static const votv::util::FieldSnapshot<TimeInfo> layout{
+                {&TimeInfo::current_day, STR("timeZ"), offsetof(FIntVector, Z)},
+                {&TimeInfo::day, STR("day")},
+                {&TimeInfo::phase, STR("phase")},
+                {&TimeInfo::phaseSin, STR("phaseSin")},
+                {&TimeInfo::phaseNormSin, STR("phaseNormSin")},
+                {&TimeInfo::maxTime, STR("maxTime")},
+                {&TimeInfo::totalTime, STR("totalTime")},
+                {&TimeInfo::timeScale, STR("timeScale")},
+                {&TimeInfo::sleepingTimeDilation, STR("sleepingTimeDilation")}
             };
+            return layout.Read(this);
         }
 
         WeatherInfo GetWeatherInfo() const {
-            return {
-                isActive, starActive, rain, isRaining, rainMuted,
-                diffMult, sunHeight, rainSpeed, thickFog,
-                rainStrength, permanentRain, permanentFog
+            static const votv::util::FieldSnapshot<WeatherInfo> layout{
+                {&WeatherInfo::isActive, STR("isActive")},
+                {&WeatherInfo::starActive, STR("starActive")},
+                {&WeatherInfo::rain, STR("rain")},
+                {&WeatherInfo::isRaining, STR("isRaining")},
+                {&WeatherInfo::rainMuted, STR("rainMuted")},
+                {&WeatherInfo::diffMult, STR("diffMult")},
+                {&WeatherInfo::sunHeight, STR("sunHeight")},
+                {&WeatherInfo::rainSpeed, STR("rainSpeed")},
+                {&WeatherInfo::thickFog, STR("thickFog")},
+                {&WeatherInfo::rainStrength, STR("rainStrength")},
+                {&WeatherInfo::permanentRain, STR("permanentRain")},
+                {&WeatherInfo::permanentFog, STR("permanentFog")}
             };
+            return layout.Read(this);
         }
     };
 
@@ -684,6 +725,8 @@ namespace votv::game {
     // Bed class (new typed class, was AActor* in 0.8.11)
     class Bed : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(Bed);
+
         UE4SS_FIELD(bool, dropItem);
         UE4SS_FIELD(float, dreamProb);
         UE4SS_FIELD(float, comfort);
@@ -693,6 +736,8 @@ namespace votv::game {
     // Grime class (replaces grunge system in 0.9.0)
     class Grime : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(Grime);
+
         UE4SS_FIELD(int32_t, type);
         UE4SS_FIELD(float, process);
         UE4SS_FIELD(RC::Unreal::FName, cleanParameter);
@@ -708,6 +753,8 @@ namespace votv::game {
     // Growing plant base class (new in 0.9.0)
     class GrowingPlant : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(GrowingPlant);
+
         UE4SS_FIELD(RC::Unreal::FName, plant);
         UE4SS_FIELD(float, growRate);
         UE4SS_FIELD(float, grow);
@@ -727,6 +774,8 @@ namespace votv::game {
     // Server box class (new in 0.9.0)
     class ServerBox : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(ServerBox);
+
         UE4SS_FIELD(RC::Unreal::FString, name);
         UE4SS_FIELD(bool, active);
         UE4SS_FIELD(bool, calc);
@@ -752,6 +801,8 @@ namespace votv::game {
     // Sit box class (new in 0.9.0)
     class SitBox : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(SitBox);
+
         UE4SS_VECTOR_FIELD(location);
         UE4SS_FIELD(float, distance);
         UE4SS_FIELD(bool, enableIcon);
@@ -761,6 +812,8 @@ namespace votv::game {
     // Padlock class (new in 0.9.0)
     class Padlock : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(Padlock);
+
         UE4SS_FIELD(float, radius);
         UE4SS_VECTOR_FIELD(grabOffset);
         UE4SS_FIELD(RC::Unreal::FName, Name);
@@ -771,6 +824,8 @@ namespace votv::game {
     // Tool gun class (new in 0.9.0)
     class ToolGun : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(ToolGun);
+
         UE4SS_FIELD(RC::Unreal::FName, Name);
         UE4SS_FIELD(RC::Unreal::FName, activeTool);
         UE4SS_FIELD(MainPlayer*, player);
@@ -781,6 +836,8 @@ namespace votv::game {
     // Video camera class (new in 0.9.0)
     class VidCam : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(VidCam);
+
         UE4SS_FIELD(float, battery);
         UE4SS_FIELD(int32_t, quality);
         UE4SS_FIELD(float, imageQuality);
@@ -795,6 +852,8 @@ namespace votv::game {
     // Workbench class (new in 0.9.0)
     class Workbench : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(Workbench);
+
         UE4SS_FIELD(RC::Unreal::FName, Name);
         UE4SS_FIELD(bool, isCrafting);
         UE4SS_FIELD(bool, canCraft);
@@ -807,6 +866,8 @@ namespace votv::game {
     // ATM class (new in 0.9.0)
     class ATM : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(ATM);
+
         UE4SS_FIELD(bool, lookingAt);
         UE4SS_FIELD(bool, isBusy);
         UE4SS_FIELD(RC::Unreal::FName, billType);
@@ -816,6 +877,8 @@ namespace votv::game {
     // Sleeping bag class (new in 0.9.0)
     class SleepingBag : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(SleepingBag);
+
         UE4SS_FIELD(RC::Unreal::FName, Name);
         UE4SS_FIELD(bool, unwrapOnBed);
     };
@@ -823,10 +886,58 @@ namespace votv::game {
     // Whiteboard class (new in 0.9.0)
     class Whiteboard : public RC::Unreal::AActor {
     public:
+        UE4SS_CLASS(Whiteboard);
+
         UE4SS_FIELD(RC::Unreal::FName, Name);
         UE4SS_FIELD(RC::Unreal::FString, str);
     };
 
+    // =========================================================================
+    // Field binding
+    // =========================================================================
+
+    /// Resolve every field of every wrapper in this header in one pass
+    /// Fills the offset cache so the first in-game frame runs at steady-state cost,
+    /// and logs every missing or mismatched field as one batch.
+    ///
+    /// Nothing calls this automatically, call it once per game mode from the game thread,
+    /// e.g. from a post hook on the game mode's ReceiveBeginPlay. Wrappers reachable from
+    /// the game mode bind against their instances' classes, the rest are looked up by name.
+    /// @param gameMode The live game mode, nullptr looks every class up by name
+    /// @param binder Extra wrappers to bind alongside, e.g. binder.Add<Cremator>()
+    /// @return Report of bound fields and issues found
+    inline votv::util::FieldBindReport BindAll(GameMode* gameMode, votv::util::FieldBinder binder = {}) {
+        auto classOf = [](const RC::Unreal::UObject* object) -> RC::Unreal::UClass* {
+            return object ? object->GetClassPrivate() : nullptr;
+        };
+
+        MainPlayer* player = gameMode ? gameMode->mainPlayer : nullptr;
+        binder.Add<GameMode>(classOf(gameMode))
+              .Add<MainPlayer>(classOf(player))
+              .Add<SaveSlot>(gameMode ? classOf(gameMode->saveSlot) : nullptr)
+              .Add<DayNightCycle>(gameMode ? classOf(gameMode->daynightCycle) : nullptr)
+              .Add<GameInstance>(gameMode ? classOf(gameMode->gameInstance) : nullptr)
+              .Add<ATV>(player ? classOf(player->atv) : nullptr)
+              .Add<Prop_Hook>(player ? classOf(player->activeHook) : nullptr)
+              .Add<KerfurOmega>()
+              .Add<Prop>()
+              .Add<Door>()
+              .Add<Bed>()
+              .Add<Grime>()
+              .Add<GrowingPlant>()
+              .Add<ServerBox>()
+              .Add<SitBox>()
+              .Add<Padlock>()
+              .Add<ToolGun>()
+              .Add<VidCam>()
+              .Add<Workbench>()
+              .Add<ATM>()
+              .Add<SleepingBag>()
+              .Add<Whiteboard>();
+
+        return binder.Run();
+    }
+
 } // namespace votv::game
 
 // Credit: MrDrNose